@@ -23,6 +23,7 @@ namespace lar_content
 BdtBeamParticleIdTool::BdtBeamParticleIdTool() :
     m_useTrainingMode(false),
     m_trainingOutputFile(""),
+    m_trainingOutputFormat(LArMvaHelper::TEXT_OUTPUT),
     m_minPurity(0.8f),
     m_minCompleteness(0.8f),
     m_adaBoostDecisionTree(AdaBoostDecisionTree()),
@@ -113,9 +114,10 @@ void BdtBeamParticleIdTool::SelectOutputPfos(const pandora::Algorithm *const pAl
             if (std::find(bestSliceIndices.begin(), bestSliceIndices.end(), sliceIndex) != bestSliceIndices.end())
                 isGoodTrainingSlice = true;
 
-            LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, isGoodTrainingSlice, featureVector);
+            LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, m_trainingOutputFormat, isGoodTrainingSlice, featureVector);
         }
 
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMvaHelper::FlushTrainingExamples());
         return;
     }
 
@@ -680,6 +682,11 @@ StatusCode BdtBeamParticleIdTool::ReadSettings(const TiXmlHandle xmlHandle)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle,
             "TrainingOutputFileName", m_trainingOutputFile));
 
+        bool writeBinaryTrainingExamples(false);
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+            "WriteBinaryTrainingExamples", writeBinaryTrainingExamples));
+        m_trainingOutputFormat = (writeBinaryTrainingExamples ? LArMvaHelper::TEXT_AND_BINARY_OUTPUT : LArMvaHelper::TEXT_OUTPUT);
+
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle,
             "CaloHitListName", m_caloHitListName));
 
@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArControlFlow/CosmicRayTaggingTool.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
@@ -26,6 +27,7 @@ CosmicRayTaggingTool::CosmicRayTaggingTool() :
     m_positionalUncertainty(3.f),
     m_maxAssociationDist(3.f * 18.f),
     m_minimumHits(15),
+    m_nThreads(1),
     m_inTimeMargin(5.f),
     m_inTimeMaxX0(1.f),
     m_marginY(20.f),
@@ -160,7 +162,8 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
     const LArTPC *const pFirstLArTPC(this->GetPandora().GetGeometry()->GetLArTPCMap().begin()->second);
     const float layerPitch(pFirstLArTPC->GetWirePitchW());
 
-    PfoToSlidingFitsMap pfoToSlidingFitsMap;
+    PfoVector fittedPfos;
+    ClusterVector fittedClusters;
 
     for (const ParticleFlowObject *const pPfo : parentCosmicRayPfos)
     {
@@ -168,10 +171,26 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
         if (!this->GetValid3DCluster(pPfo, pCluster) || !pCluster)
             continue;
 
-        (void) pfoToSlidingFitsMap.insert(PfoToSlidingFitsMap::value_type(pPfo, std::make_pair(
-            ThreeDSlidingFitResult(pCluster, 5, layerPitch), ThreeDSlidingFitResult(pCluster, 100, layerPitch)))); // TODO Configurable
+        fittedPfos.push_back(pPfo);
+        fittedClusters.push_back(pCluster);
     }
 
+    ClusterToSlidingFitsMap clusterToSlidingFitsMap;
+    LArParallelHelper::ClusterFailureList fitFailures;
+
+    LArParallelHelper::FitClusters(fittedClusters, m_nThreads, [&](const Cluster *const pCluster) {
+        return SlidingFitPair(ThreeDSlidingFitResult(pCluster, 5, layerPitch), ThreeDSlidingFitResult(pCluster, 100, layerPitch)); // TODO Configurable
+    }, clusterToSlidingFitsMap, fitFailures);
+
+    // ATTN Sliding fit failures are not tolerated here, so report the first failure, in pfo order, as would a serial evaluation
+    if (!fitFailures.empty())
+        throw StatusCodeException(fitFailures.front().second);
+
+    PfoToSlidingFitsMap pfoToSlidingFitsMap;
+
+    for (unsigned int iPfo = 0; iPfo < fittedPfos.size(); ++iPfo)
+        (void) pfoToSlidingFitsMap.insert(PfoToSlidingFitsMap::value_type(fittedPfos.at(iPfo), clusterToSlidingFitsMap.at(fittedClusters.at(iPfo))));
+
     for (const ParticleFlowObject *const pPfo1 : parentCosmicRayPfos)
     {
         PfoToSlidingFitsMap::const_iterator iter1(pfoToSlidingFitsMap.find(pPfo1));
@@ -582,6 +601,9 @@ StatusCode CosmicRayTaggingTool::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "HitThreshold", m_minimumHits));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NThreads", m_nThreads));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "InTimeMargin", m_inTimeMargin));
 
@@ -185,6 +185,7 @@ private:
 
     typedef std::pair<const ThreeDSlidingFitResult, const ThreeDSlidingFitResult> SlidingFitPair;
     typedef std::unordered_map<const pandora::ParticleFlowObject *, SlidingFitPair> PfoToSlidingFitsMap;
+    typedef std::unordered_map<const pandora::Cluster *, SlidingFitPair> ClusterToSlidingFitsMap;
     typedef std::vector<pandora::PfoList> SliceList;
 
     /**
@@ -199,6 +200,7 @@ private:
     float           m_maxAssociationDist;       ///< The maximum distance from endpoint to point of closest approach, typically a multiple of LAr radiation length
 
     unsigned int    m_minimumHits;              ///< The minimum number of hits for a Pfo to be considered
+    unsigned int    m_nThreads;                 ///< The maximum number of threads used to construct the sliding fits
 
     float           m_inTimeMargin;             ///< The maximum distance outside of the physical detector volume that a Pfo may be to still be considered in time
     float           m_inTimeMaxX0;              ///< The maximum pfo x0 (determined from shifted vertex) to allow pfo to still be considered in time
@@ -21,6 +21,7 @@
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 #include "larpandoracontent/LArObjects/LArMCParticle.h"
+#include "larpandoracontent/LArObjects/LArSlidingFitCache.h"
 
 #include "larpandoracontent/LArPlugins/LArPseudoLayerPlugin.h"
 #include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
@@ -57,6 +58,17 @@ MasterAlgorithm::MasterAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+MasterAlgorithm::~MasterAlgorithm()
+{
+    PandoraInstanceList pandoraInstances;
+    this->GetPandoraInstances(pandoraInstances);
+
+    for (const Pandora *const pPandora : pandoraInstances)
+        SlidingFitCache::Release(*pPandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void MasterAlgorithm::ShiftPfoHierarchy(const ParticleFlowObject *const pParentPfo, const PfoToLArTPCMap &pfoToLArTPCMap, const float x0) const
 {
     if (!pParentPfo->GetParentPfoList().empty())
@@ -639,6 +651,20 @@ StatusCode MasterAlgorithm::Reset()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void MasterAlgorithm::GetPandoraInstances(PandoraInstanceList &pandoraInstances) const
+{
+    pandoraInstances.push_back(&(this->GetPandora()));
+    pandoraInstances.insert(pandoraInstances.end(), m_crWorkerInstances.begin(), m_crWorkerInstances.end());
+
+    for (const Pandora *const pPandora : {m_pSlicingWorkerInstance, m_pSliceNuWorkerInstance, m_pSliceCRWorkerInstance})
+    {
+        if (pPandora)
+            pandoraInstances.push_back(pPandora);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::Copy(const Pandora *const pPandora, const CaloHit *const pCaloHit) const
 {
     const LArCaloHit *const pLArCaloHit{dynamic_cast<const LArCaloHit*>(pCaloHit)};
@@ -43,6 +43,11 @@ public:
      */
     MasterAlgorithm();
 
+    /**
+     *  @brief  Destructor, releasing the event caches held for this and the worker instances
+     */
+    ~MasterAlgorithm();
+
     /**
      *  @brief  External steering parameters class
      */
@@ -180,6 +185,13 @@ protected:
      */
     pandora::StatusCode Reset();
 
+    /**
+     *  @brief  Get this pandora instance and all worker instances
+     *
+     *  @param  pandoraInstances to receive the addresses of the pandora instances
+     */
+    void GetPandoraInstances(PandoraInstanceList &pandoraInstances) const;
+
     /**
      *  @brief  Copy a specified calo hit to the provided pandora instance
      *
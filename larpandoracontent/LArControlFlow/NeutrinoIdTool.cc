@@ -15,11 +15,14 @@
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
+#include <memory>
+
 using namespace pandora;
 
 namespace lar_content
@@ -28,13 +31,15 @@ namespace lar_content
 template<typename T>
 NeutrinoIdTool<T>::NeutrinoIdTool() :
     m_useTrainingMode(false),
+    m_trainingOutputFormat(LArMvaHelper::TEXT_OUTPUT),
     m_selectNuanceCode(false),
     m_nuance(-std::numeric_limits<int>::max()),
     m_minPurity(0.9f),
     m_minCompleteness(0.9f),
     m_minProbability(0.0f),
     m_maxNeutrinos(1),
-    m_filePathEnvironmentVariable("FW_SEARCH_PATH")
+    m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
+    m_nThreads(1)
 {
 }
 
@@ -67,9 +72,10 @@ void NeutrinoIdTool<T>::SelectOutputPfos(const Algorithm *const pAlgorithm, cons
 
             LArMvaHelper::MvaFeatureVector featureVector;
             features.GetFeatureVector(featureVector);
-            LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, sliceIndex == bestSliceIndex, featureVector);
+            LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, m_trainingOutputFormat, sliceIndex == bestSliceIndex, featureVector);
         }
 
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMvaHelper::FlushTrainingExamples());
         return;
     }
 
@@ -81,8 +87,18 @@ void NeutrinoIdTool<T>::SelectOutputPfos(const Algorithm *const pAlgorithm, cons
 template<typename T>
 void NeutrinoIdTool<T>::GetSliceFeatures(const NeutrinoIdTool<T> *const pTool, const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses, SliceFeaturesVector &sliceFeaturesVector) const
 {
-    for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
-        sliceFeaturesVector.push_back(SliceFeatures(nuSliceHypotheses.at(sliceIndex), crSliceHypotheses.at(sliceIndex), pTool));
+    // ATTN Feature calculation only reads the pfos and geometry, so slices are independent. Features are stored in slice order.
+    const unsigned int nSlices(nuSliceHypotheses.size());
+    std::vector<std::unique_ptr<SliceFeatures>> sliceFeaturesPtrVector(nSlices);
+
+    LArParallelHelper::ForEach(nSlices, m_nThreads, [&](const std::size_t sliceIndex) {
+        sliceFeaturesPtrVector.at(sliceIndex).reset(new SliceFeatures(nuSliceHypotheses.at(sliceIndex), crSliceHypotheses.at(sliceIndex), pTool));
+    });
+
+    sliceFeaturesVector.reserve(sliceFeaturesVector.size() + nSlices);
+
+    for (const std::unique_ptr<SliceFeatures> &pSliceFeatures : sliceFeaturesPtrVector)
+        sliceFeaturesVector.push_back(*pSliceFeatures);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -114,12 +130,13 @@ bool NeutrinoIdTool<T>::GetBestMCSliceIndex(const Algorithm *const pAlgorithm, c
     for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
     {
         CaloHitList reconstructedCaloHitList;
-        this->Collect2DHits(crSliceHypotheses.at(sliceIndex), reconstructedCaloHitList, reconstructableCaloHitSet);
+        CaloHitSet reconstructedCaloHitSet;
+        this->Collect2DHits(crSliceHypotheses.at(sliceIndex), reconstructedCaloHitList, reconstructedCaloHitSet, reconstructableCaloHitSet);
 
         for (const ParticleFlowObject *const pNeutrino : nuSliceHypotheses.at(sliceIndex))
         {
             const PfoList &nuFinalStates(pNeutrino->GetDaughterPfoList());
-            this->Collect2DHits(nuFinalStates, reconstructedCaloHitList, reconstructableCaloHitSet);
+            this->Collect2DHits(nuFinalStates, reconstructedCaloHitList, reconstructedCaloHitSet, reconstructableCaloHitSet);
         }
 
         const unsigned int nNuHits(this->CountNeutrinoInducedHits(reconstructedCaloHitList));
@@ -152,7 +169,8 @@ bool NeutrinoIdTool<T>::PassesQualityCuts(const Algorithm *const pAlgorithm, con
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template<typename T>
-void NeutrinoIdTool<T>::Collect2DHits(const PfoList &pfos, CaloHitList &reconstructedCaloHitList, const CaloHitSet &reconstructableCaloHitSet) const
+void NeutrinoIdTool<T>::Collect2DHits(const PfoList &pfos, CaloHitList &reconstructedCaloHitList, CaloHitSet &reconstructedCaloHitSet,
+    const CaloHitSet &reconstructableCaloHitSet) const
 {
     CaloHitList collectedHits;
     LArPfoHelper::GetCaloHits(pfos, TPC_VIEW_U, collectedHits);
@@ -166,7 +184,7 @@ void NeutrinoIdTool<T>::Collect2DHits(const PfoList &pfos, CaloHitList &reconstr
             continue;
 
         // Ensure no hits have been double counted
-        if (std::find(reconstructedCaloHitList.begin(), reconstructedCaloHitList.end(), pParentHit) == reconstructedCaloHitList.end())
+        if (reconstructedCaloHitSet.insert(pParentHit).second)
             reconstructedCaloHitList.push_back(pParentHit);
     }
 }
@@ -544,6 +562,11 @@ StatusCode NeutrinoIdTool<T>::ReadSettings(const TiXmlHandle xmlHandle)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle,
             "TrainingOutputFileName", m_trainingOutputFile));
+
+        bool writeBinaryTrainingExamples(false);
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+            "WriteBinaryTrainingExamples", writeBinaryTrainingExamples));
+        m_trainingOutputFormat = (writeBinaryTrainingExamples ? LArMvaHelper::TEXT_AND_BINARY_OUTPUT : LArMvaHelper::TEXT_OUTPUT);
     }
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -570,6 +593,9 @@ StatusCode NeutrinoIdTool<T>::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "FilePathEnvironmentVariable", m_filePathEnvironmentVariable));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NThreads", m_nThreads));
+
     if (!m_useTrainingMode)
     {
         std::string mvaName;
@@ -188,9 +188,11 @@ private:
      *
      *  @param  pfos input list of pfos
      *  @param  reconstructedCaloHitList output list of all 2d hits in the input pfos
+     *  @param  reconstructedCaloHitSet set of the hits already in the output list, used to avoid double counting
      *  @param  reconstructableCaloHitSet set of reconstructable calo hits
      */
-    void Collect2DHits(const pandora::PfoList &pfos, pandora::CaloHitList &reconstructedCaloHitList, const pandora::CaloHitSet &reconstructableCaloHitSet) const;
+    void Collect2DHits(const pandora::PfoList &pfos, pandora::CaloHitList &reconstructedCaloHitList, pandora::CaloHitSet &reconstructedCaloHitSet,
+        const pandora::CaloHitSet &reconstructableCaloHitSet) const;
 
     /**
      *  @brief  Count the number of neutrino induced hits in a given list using MC information
@@ -243,6 +245,7 @@ private:
     // Training
     bool                  m_useTrainingMode;              ///< Should use training mode. If true, training examples will be written to the output file
     std::string           m_trainingOutputFile;           ///< Output file name for training examples
+    LArMvaHelper::TrainingOutputFormat m_trainingOutputFormat; ///< The output format for training examples
     bool                  m_selectNuanceCode;             ///< Should select training events by nuance code
     int                   m_nuance;                       ///< Nuance code to select for training
     float                 m_minPurity;                    ///< Minimum purity of the best slice to use event for training
@@ -254,6 +257,7 @@ private:
 
     T                     m_mva;                          ///< The mva
     std::string           m_filePathEnvironmentVariable;  ///< The environment variable providing a list of paths to mva files
+    unsigned int          m_nThreads;                     ///< The maximum number of threads to use when calculating slice features
 };
 
 typedef NeutrinoIdTool<AdaBoostDecisionTree> BdtNeutrinoIdTool;
@@ -11,20 +11,31 @@
 #include "larpandoracontent/LArControlFlow/PreProcessingAlgorithm.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <tuple>
+
 using namespace pandora;
 
 namespace lar_content
 {
 
 PreProcessingAlgorithm::PreProcessingAlgorithm() :
+    m_eventNumber(0),
     m_mipEquivalentCut(std::numeric_limits<float>::epsilon()),
     m_minCellLengthScale(std::numeric_limits<float>::epsilon()),
     m_maxCellLengthScale(3.f),
     m_searchRegion1D(0.1f),
     m_maxEventHits(std::numeric_limits<unsigned int>::max()),
+    m_downsampleOversizeEvents(false),
+    m_downsamplingCellSize(0.3f),
+    m_maxDownsamplingIterations(10),
+    m_nThreads(1),
     m_onlyAvailableCaloHits(true),
     m_inputCaloHitListName("Input")
 {
@@ -35,6 +46,7 @@ PreProcessingAlgorithm::PreProcessingAlgorithm() :
 StatusCode PreProcessingAlgorithm::Reset()
 {
     m_processedHits.clear();
+    ++m_eventNumber;
     return STATUS_CODE_SUCCESS;
 }
 
@@ -83,17 +95,36 @@ void PreProcessingAlgorithm::ProcessCaloHits()
     if (pCaloHitList->empty())
         return;
 
+    CaloHitList downsampledCaloHitList;
+
     if (pCaloHitList->size() > m_maxEventHits)
-        throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+    {
+        if (!m_downsampleOversizeEvents)
+            throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+
+        this->DownsampleCaloHits(*pCaloHitList, downsampledCaloHitList);
+    }
 
-    CaloHitList selectedCaloHitListU, selectedCaloHitListV, selectedCaloHitListW;
+    const CaloHitList &inputCaloHitList(downsampledCaloHitList.empty() ? *pCaloHitList : downsampledCaloHitList);
+    const bool checkProcessedHits(!m_processedHits.empty());
+    const std::size_t nPreviouslyProcessedHits(m_processedHits.size());
+    m_processedHits.reserve(nPreviouslyProcessedHits + inputCaloHitList.size());
 
-    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    // ATTN Single pass over the input hits, partitioning the selected hits into contiguous per-view arrays
+    CaloHitVector selectedCaloHitVectorU, selectedCaloHitVectorV, selectedCaloHitVectorW;
+    selectedCaloHitVectorU.reserve(inputCaloHitList.size());
+    selectedCaloHitVectorV.reserve(inputCaloHitList.size());
+    selectedCaloHitVectorW.reserve(inputCaloHitList.size());
+
+    for (const CaloHit *const pCaloHit : inputCaloHitList)
     {
-        if (m_processedHits.count(pCaloHit))
+        if (checkProcessedHits &&
+            std::binary_search(m_processedHits.begin(), m_processedHits.begin() + nPreviouslyProcessedHits, pCaloHit, std::less<const CaloHit *>()))
+        {
             continue;
+        }
 
-        (void) m_processedHits.insert(pCaloHit);
+        m_processedHits.push_back(pCaloHit);
 
         if (m_onlyAvailableCaloHits && !PandoraContentApi::IsAvailable(*this, pCaloHit))
             continue;
@@ -122,22 +153,39 @@ void PreProcessingAlgorithm::ProcessCaloHits()
 
         if (TPC_VIEW_U == pCaloHit->GetHitType())
         {
-            selectedCaloHitListU.push_back(pCaloHit);
+            selectedCaloHitVectorU.push_back(pCaloHit);
         }
         else if (TPC_VIEW_V == pCaloHit->GetHitType())
         {
-            selectedCaloHitListV.push_back(pCaloHit);
+            selectedCaloHitVectorV.push_back(pCaloHit);
         }
         else if (TPC_VIEW_W == pCaloHit->GetHitType())
         {
-            selectedCaloHitListW.push_back(pCaloHit);
+            selectedCaloHitVectorW.push_back(pCaloHit);
         }
     }
 
+    this->SortProcessedHits(nPreviouslyProcessedHits);
+
+    // ATTN Views are independent, so the isolated hit filtering can proceed concurrently, with each view writing only to its own output list
+    // and message list. Messages are printed afterwards, on this thread, in view order.
     CaloHitList filteredCaloHitListU, filteredCaloHitListV, filteredCaloHitListW;
-    this->GetFilteredCaloHitList(selectedCaloHitListU, filteredCaloHitListU);
-    this->GetFilteredCaloHitList(selectedCaloHitListV, filteredCaloHitListV);
-    this->GetFilteredCaloHitList(selectedCaloHitListW, filteredCaloHitListW);
+    const std::vector<std::pair<const CaloHitVector *, CaloHitList *>> viewVector{{&selectedCaloHitVectorU, &filteredCaloHitListU},
+        {&selectedCaloHitVectorV, &filteredCaloHitListV}, {&selectedCaloHitVectorW, &filteredCaloHitListW}};
+    std::vector<StringVector> viewMessages(viewVector.size());
+
+    LArParallelHelper::ForEach(viewVector.size(), m_nThreads, [&](const std::size_t index) {
+        this->GetFilteredCaloHitList(*viewVector.at(index).first, *viewVector.at(index).second, viewMessages.at(index));
+    });
+
+    if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+    {
+        for (const StringVector &messages : viewMessages)
+        {
+            for (const std::string &message : messages)
+                std::cout << message << std::endl;
+        }
+    }
 
     CaloHitList filteredInputList;
     filteredInputList.insert(filteredInputList.end(), filteredCaloHitListU.begin(), filteredCaloHitListU.end());
@@ -159,6 +207,86 @@ void PreProcessingAlgorithm::ProcessCaloHits()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void PreProcessingAlgorithm::DownsampleCaloHits(const CaloHitList &inputList, CaloHitList &outputList)
+{
+    float cellSize(m_downsamplingCellSize);
+
+    for (unsigned int iteration = 0; iteration < m_maxDownsamplingIterations; ++iteration)
+    {
+        CaloHitList representativeList;
+        this->SelectRepresentativeCaloHits(inputList, cellSize, representativeList);
+
+        if (representativeList.size() <= m_maxEventHits)
+        {
+            // ATTN Always reported, as the reconstruction of this event is degraded
+            std::cout << "PreProcessingAlgorithm: event " << m_eventNumber << " has " << inputList.size() << " hits, exceeding limit of "
+                      << m_maxEventHits << ", downsampled to " << representativeList.size() << " hits ("
+                      << 100.f * static_cast<float>(representativeList.size()) / static_cast<float>(inputList.size())
+                      << "%) using cell size " << cellSize << std::endl;
+
+            // ATTN Hits removed by the downsampling are treated as processed, so are not picked up by any subsequent call
+            const CaloHitSet representativeSet(representativeList.begin(), representativeList.end());
+
+            const std::size_t nPreviouslyProcessedHits(m_processedHits.size());
+
+            for (const CaloHit *const pCaloHit : inputList)
+            {
+                if (!representativeSet.count(pCaloHit))
+                    m_processedHits.push_back(pCaloHit);
+            }
+
+            this->SortProcessedHits(nPreviouslyProcessedHits);
+
+            outputList.swap(representativeList);
+            return;
+        }
+
+        cellSize *= 2.f;
+    }
+
+    std::cout << "PreProcessingAlgorithm: event " << m_eventNumber << " could not be downsampled below " << m_maxEventHits << " hits" << std::endl;
+
+    throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PreProcessingAlgorithm::SelectRepresentativeCaloHits(const CaloHitList &inputList, const float cellSize, CaloHitList &outputList) const
+{
+    if (cellSize < std::numeric_limits<float>::epsilon())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    typedef std::tuple<HitType, int, int> GridCell;
+    typedef std::map<GridCell, const CaloHit *> GridCellToHitMap;
+
+    GridCellToHitMap gridCellToHitMap;
+    std::vector<GridCell> hitGridCells;
+    hitGridCells.reserve(inputList.size());
+
+    for (const CaloHit *const pCaloHit : inputList)
+    {
+        const CartesianVector &position(pCaloHit->GetPositionVector());
+        const GridCell gridCell(pCaloHit->GetHitType(), static_cast<int>(std::floor(position.GetX() / cellSize)),
+            static_cast<int>(std::floor(position.GetZ() / cellSize)));
+        hitGridCells.push_back(gridCell);
+
+        const CaloHit *&pRepresentativeHit(gridCellToHitMap[gridCell]);
+
+        if (!pRepresentativeHit || (pCaloHit->GetMipEquivalentEnergy() > pRepresentativeHit->GetMipEquivalentEnergy()))
+            pRepresentativeHit = pCaloHit;
+    }
+
+    std::vector<GridCell>::const_iterator gridCellIter(hitGridCells.begin());
+
+    for (const CaloHit *const pCaloHit : inputList)
+    {
+        if (pCaloHit == gridCellToHitMap.at(*(gridCellIter++)))
+            outputList.push_back(pCaloHit);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void PreProcessingAlgorithm::PopulateVoidCaloHitLists() noexcept
 {
     CaloHitList emptyList;
@@ -185,16 +313,29 @@ void PreProcessingAlgorithm::PopulateVoidCaloHitLists() noexcept
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList, CaloHitList &outputList)
+void PreProcessingAlgorithm::SortProcessedHits(const std::size_t nPreviouslySortedHits)
+{
+    // ATTN Ordering by address is used only for membership tests, never to determine the order of any output
+    const CaloHitVector::iterator middleIter(m_processedHits.begin() + nPreviouslySortedHits);
+    std::sort(middleIter, m_processedHits.end(), std::less<const CaloHit *>());
+    std::inplace_merge(m_processedHits.begin(), middleIter, m_processedHits.end(), std::less<const CaloHit *>());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitVector &inputVector, CaloHitList &outputList, StringVector &messages) const
 {
     HitKDTree2D kdTree;
     HitKDNode2DList hitKDNode2DList;
+    hitKDNode2DList.reserve(inputVector.size());
 
-    KDTreeBox hitsBoundingRegion2D = fill_and_bound_2d_kd_tree(inputList, hitKDNode2DList);
+    KDTreeBox hitsBoundingRegion2D = fill_and_bound_2d_kd_tree(inputVector, hitKDNode2DList);
     kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
 
+    CaloHitSet outputSet;
+
     // Remove hits that are in the same physical location!
-    for (const CaloHit *const pCaloHit1 : inputList)
+    for (const CaloHit *const pCaloHit1 : inputVector)
     {
         bool isUnique(true);
         KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit1, m_searchRegion1D, m_searchRegion1D));
@@ -216,7 +357,7 @@ void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList
                 const float deltaMip(pCaloHit2->GetMipEquivalentEnergy() > pCaloHit1->GetMipEquivalentEnergy());
 
                 if ((deltaMip > std::numeric_limits<float>::epsilon()) ||
-                    ((std::fabs(deltaMip) < std::numeric_limits<float>::epsilon()) && (outputList.end() != std::find(outputList.begin(), outputList.end(), pCaloHit2))))
+                    ((std::fabs(deltaMip) < std::numeric_limits<float>::epsilon()) && outputSet.count(pCaloHit2)))
                 {
                     isUnique = false;
                     break;
@@ -227,11 +368,11 @@ void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList
         if (isUnique)
         {
             outputList.push_back(pCaloHit1);
+            (void)outputSet.insert(pCaloHit1);
         }
         else
         {
-            if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
-                std::cout << "PreProcessingAlgorithm: found two hits in same location, will remove lowest pulse height" << std::endl;
+            messages.push_back("PreProcessingAlgorithm: found two hits in same location, will remove lowest pulse height");
         }
     }
 }
@@ -255,6 +396,18 @@ StatusCode PreProcessingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "MaxEventHits", m_maxEventHits));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "DownsampleOversizeEvents", m_downsampleOversizeEvents));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "DownsamplingCellSize", m_downsamplingCellSize));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "MaxDownsamplingIterations", m_maxDownsamplingIterations));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NThreads", m_nThreads));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "OnlyAvailableCaloHits", m_onlyAvailableCaloHits));
 
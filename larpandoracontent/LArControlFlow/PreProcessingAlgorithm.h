@@ -43,39 +43,70 @@ private:
      */
     void ProcessCaloHits();
 
+    /**
+     *  @brief Reduce an oversize input calo hit list to at most the maximum number of event hits, by retaining only the
+     *         highest pulse height hit in each cell of a per-view grid, doubling the cell size until the hit budget is met
+     *
+     *  @param inputList the input calo hit list
+     *  @param outputList to receive the downsampled calo hit list
+     */
+    void DownsampleCaloHits(const pandora::CaloHitList &inputList, pandora::CaloHitList &outputList);
+
+    /**
+     *  @brief Retain only the highest pulse height hit in each cell of a per-view grid
+     *
+     *  @param inputList the input calo hit list
+     *  @param cellSize the grid cell size
+     *  @param outputList to receive the representative calo hits, in the order of the input list
+     */
+    void SelectRepresentativeCaloHits(const pandora::CaloHitList &inputList, const float cellSize, pandora::CaloHitList &outputList) const;
+
     /**
      *  @brief Build empty calo hit lists
      */
     void PopulateVoidCaloHitLists() noexcept;
 
     /**
-     *  @brief Clean up the input CaloHitList
+     *  @brief Restore the address ordering of the processed hits, after appending new hits to the previously sorted hits
+     *
+     *  @param nPreviouslySortedHits the number of processed hits that are already sorted
+     */
+    void SortProcessedHits(const std::size_t nPreviouslySortedHits);
+
+    /**
+     *  @brief Clean up the input calo hits for a single view
      *
-     *  @param inputList the input CaloHitList
+     *  @param inputVector the input calo hit vector
      *  @param outputList the output CaloHitList
+     *  @param messages to receive the messages to print, so that they can be printed by the calling thread
      */
-    void GetFilteredCaloHitList(const pandora::CaloHitList &inputList, pandora::CaloHitList &outputList);
+    void GetFilteredCaloHitList(const pandora::CaloHitVector &inputVector, pandora::CaloHitList &outputList, pandora::StringVector &messages) const;
 
     /**
      *  @brief Build separate MCParticleLists for each view
      */
     void ProcessMCParticles();
 
-    pandora::CaloHitSet m_processedHits;                    ///< The set of all previously processed calo hits
-
-    float               m_mipEquivalentCut;                 ///< Minimum mip equivalent energy for calo hit
-    float               m_minCellLengthScale;               ///< The minimum length scale for calo hit
-    float               m_maxCellLengthScale;               ///< The maximum length scale for calo hit
-    float               m_searchRegion1D;                   ///< Search region, applied to each dimension, for look-up from kd-trees
-    unsigned int        m_maxEventHits;                     ///< The maximum number of hits in an event to proceed with the reconstruction
-
-    bool                m_onlyAvailableCaloHits;            ///< Whether to only include available calo hits
-    std::string         m_inputCaloHitListName;             ///< The input calo hit list name
-    std::string         m_outputCaloHitListNameU;           ///< The output calo hit list name for TPC_VIEW_U hits
-    std::string         m_outputCaloHitListNameV;           ///< The output calo hit list name for TPC_VIEW_V hits
-    std::string         m_outputCaloHitListNameW;           ///< The output calo hit list name for TPC_VIEW_W hits
-    std::string         m_filteredCaloHitListName;          ///< The output calo hit list name for all U, V and W hits
-    std::string         m_currentCaloHitListReplacement;    ///< The name of the calo hit list to replace the current list (optional)
+    pandora::CaloHitVector m_processedHits;                    ///< All previously processed calo hits, sorted by address for binary search
+    int                    m_eventNumber;                      ///< The event number, used to record which events were degraded
+
+    float                  m_mipEquivalentCut;                 ///< Minimum mip equivalent energy for calo hit
+    float                  m_minCellLengthScale;               ///< The minimum length scale for calo hit
+    float                  m_maxCellLengthScale;               ///< The maximum length scale for calo hit
+    float                  m_searchRegion1D;                   ///< Search region, applied to each dimension, for look-up from kd-trees
+    unsigned int           m_maxEventHits;                     ///< The maximum number of hits in an event to proceed with the reconstruction
+    bool                   m_downsampleOversizeEvents;         ///< Whether to downsample events exceeding the maximum number of hits, rather than skip them
+    float                  m_downsamplingCellSize;             ///< The initial grid cell size used when downsampling oversize events
+    unsigned int           m_maxDownsamplingIterations;        ///< The maximum number of cell size doublings before an oversize event is skipped
+    unsigned int           m_nThreads;                         ///< The maximum number of threads used to filter the views concurrently
+
+    bool                   m_onlyAvailableCaloHits;            ///< Whether to only include available calo hits
+    std::string            m_inputCaloHitListName;             ///< The input calo hit list name
+    std::string            m_outputCaloHitListNameU;           ///< The output calo hit list name for TPC_VIEW_U hits
+    std::string            m_outputCaloHitListNameV;           ///< The output calo hit list name for TPC_VIEW_V hits
+    std::string            m_outputCaloHitListNameW;           ///< The output calo hit list name for TPC_VIEW_W hits
+    std::string            m_filteredCaloHitListName;          ///< The output calo hit list name for all U, V and W hits
+    std::string            m_currentCaloHitListReplacement;    ///< The name of the calo hit list to replace the current list (optional)
 };
 
 } // namespace lar_content
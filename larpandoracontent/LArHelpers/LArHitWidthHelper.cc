@@ -38,6 +38,7 @@ LArHitWidthHelper::ClusterParameters::ClusterParameters(const Cluster *const pCl
     m_pCluster(pCluster),
     m_numCaloHits(pCluster->GetNCaloHits()),
     m_constituentHitVector(LArHitWidthHelper::GetConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniformHits)),
+    m_layerConstituentCounts(LArHitWidthHelper::GetLayerConstituentCounts(pCluster, maxConstituentHitWidth, hitWidthScalingFactor)),
     m_totalWeight(LArHitWidthHelper::GetTotalClusterWeight(m_constituentHitVector)),
     m_lowerXExtrema(LArHitWidthHelper::GetExtremalCoordinatesLowerX(m_constituentHitVector)),
     m_higherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(m_constituentHitVector))
@@ -51,12 +52,27 @@ LArHitWidthHelper::ClusterParameters::ClusterParameters(const Cluster *const pCl
     m_pCluster(pCluster),
     m_numCaloHits(numCaloHits),
     m_constituentHitVector(constituentHitVector),
+    m_layerConstituentCounts(),
     m_totalWeight(totalWeight),
     m_lowerXExtrema(lowerXExtrema),
     m_higherXExtrema(higherXExtrema)
 {
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArHitWidthHelper::ClusterParameters::ClusterParameters(const ClusterParameters &enlargeParameters, const ClusterParameters &deleteParameters) :
+    m_pCluster(enlargeParameters.GetClusterAddress()),
+    m_numCaloHits(enlargeParameters.GetNumCaloHits() + deleteParameters.GetNumCaloHits()),
+    m_constituentHitVector(LArHitWidthHelper::GetMergedConstituentHits(enlargeParameters, deleteParameters)),
+    m_layerConstituentCounts(LArHitWidthHelper::GetMergedLayerConstituentCounts(enlargeParameters.GetLayerConstituentCounts(),
+        deleteParameters.GetLayerConstituentCounts())),
+    m_totalWeight(LArHitWidthHelper::GetTotalClusterWeight(m_constituentHitVector)),
+    m_lowerXExtrema(LArHitWidthHelper::GetExtremalCoordinatesLowerX(m_constituentHitVector)),
+    m_higherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(m_constituentHitVector))
+{
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -192,6 +208,112 @@ void LArHitWidthHelper::SplitHitIntoConstituents(const CaloHit *const pCaloHit,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+LArHitWidthHelper::LayerConstituentCountVector LArHitWidthHelper::GetLayerConstituentCounts(const Cluster *const pCluster,
+    const float maxConstituentHitWidth, const float hitWidthScalingFactor)
+{
+    // ATTN Must match the number of constituent hits added for each calo hit by GetConstituentHits
+    LayerConstituentCountVector layerConstituentCounts;
+
+    for (const OrderedCaloHitList::value_type &mapEntry : pCluster->GetOrderedCaloHitList())
+    {
+        unsigned int nConstituentHits(0);
+
+        for (const CaloHit *const pCaloHit : *mapEntry.second)
+        {
+            const float hitWidth = pCaloHit->GetCellSize1() * hitWidthScalingFactor;
+            const unsigned int numberOfConstituentHits = std::ceil(hitWidth / maxConstituentHitWidth);
+
+            nConstituentHits += numberOfConstituentHits;
+        }
+
+        layerConstituentCounts.emplace_back(mapEntry.first, nConstituentHits);
+    }
+
+    return layerConstituentCounts;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArHitWidthHelper::ConstituentHitVector LArHitWidthHelper::GetMergedConstituentHits(const ClusterParameters &enlargeParameters,
+    const ClusterParameters &deleteParameters)
+{
+    const ConstituentHitVector &enlargeHitVector(enlargeParameters.GetConstituentHitVector()), &deleteHitVector(deleteParameters.GetConstituentHitVector());
+    const LayerConstituentCountVector &enlargeCounts(enlargeParameters.GetLayerConstituentCounts()), &deleteCounts(deleteParameters.GetLayerConstituentCounts());
+    const Cluster *const pCluster(enlargeParameters.GetClusterAddress());
+
+    // ATTN Merging appends the hits of the deleted cluster to the calo hit list for each pseudo layer, so walk the two vectors layer by layer
+    ConstituentHitVector constituentHitVector;
+    constituentHitVector.reserve(enlargeHitVector.size() + deleteHitVector.size());
+
+    LayerConstituentCountVector::const_iterator enlargeCountIter(enlargeCounts.begin()), deleteCountIter(deleteCounts.begin());
+    ConstituentHitVector::const_iterator enlargeHitIter(enlargeHitVector.begin()), deleteHitIter(deleteHitVector.begin());
+
+    while ((enlargeCounts.end() != enlargeCountIter) || (deleteCounts.end() != deleteCountIter))
+    {
+        const bool useEnlarge((deleteCounts.end() == deleteCountIter) ||
+            ((enlargeCounts.end() != enlargeCountIter) && (enlargeCountIter->first <= deleteCountIter->first)));
+        const unsigned int pseudoLayer(useEnlarge ? enlargeCountIter->first : deleteCountIter->first);
+
+        if ((enlargeCounts.end() != enlargeCountIter) && (enlargeCountIter->first == pseudoLayer))
+        {
+            if (static_cast<std::size_t>(enlargeHitVector.end() - enlargeHitIter) < enlargeCountIter->second)
+                throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+            for (const ConstituentHitVector::const_iterator endIter(enlargeHitIter + enlargeCountIter->second); enlargeHitIter != endIter; ++enlargeHitIter)
+                constituentHitVector.push_back(ConstituentHit(enlargeHitIter->GetPositionVector(), enlargeHitIter->GetHitWidth(), pCluster));
+
+            ++enlargeCountIter;
+        }
+
+        if ((deleteCounts.end() != deleteCountIter) && (deleteCountIter->first == pseudoLayer))
+        {
+            if (static_cast<std::size_t>(deleteHitVector.end() - deleteHitIter) < deleteCountIter->second)
+                throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+            for (const ConstituentHitVector::const_iterator endIter(deleteHitIter + deleteCountIter->second); deleteHitIter != endIter; ++deleteHitIter)
+                constituentHitVector.push_back(ConstituentHit(deleteHitIter->GetPositionVector(), deleteHitIter->GetHitWidth(), pCluster));
+
+            ++deleteCountIter;
+        }
+    }
+
+    if ((enlargeHitVector.end() != enlargeHitIter) || (deleteHitVector.end() != deleteHitIter))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    return constituentHitVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArHitWidthHelper::LayerConstituentCountVector LArHitWidthHelper::GetMergedLayerConstituentCounts(const LayerConstituentCountVector &firstCounts,
+    const LayerConstituentCountVector &secondCounts)
+{
+    LayerConstituentCountVector layerConstituentCounts;
+    LayerConstituentCountVector::const_iterator firstIter(firstCounts.begin()), secondIter(secondCounts.begin());
+
+    while ((firstCounts.end() != firstIter) || (secondCounts.end() != secondIter))
+    {
+        if ((secondCounts.end() == secondIter) || ((firstCounts.end() != firstIter) && (firstIter->first < secondIter->first)))
+        {
+            layerConstituentCounts.push_back(*firstIter++);
+        }
+        else if ((firstCounts.end() == firstIter) || (secondIter->first < firstIter->first))
+        {
+            layerConstituentCounts.push_back(*secondIter++);
+        }
+        else
+        {
+            layerConstituentCounts.emplace_back(firstIter->first, firstIter->second + secondIter->second);
+            ++firstIter;
+            ++secondIter;
+        }
+    }
+
+    return layerConstituentCounts;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float LArHitWidthHelper::GetTotalClusterWeight(const ConstituentHitVector &constituentHitVector)
 {
     float clusterWeight(0.f);
@@ -83,6 +83,8 @@ public:
     };
 
     typedef std::vector<ConstituentHit> ConstituentHitVector;
+    typedef std::pair<unsigned int, unsigned int> LayerConstituentCount;    ///< A pseudo layer and the number of constituent hits in it
+    typedef std::vector<LayerConstituentCount> LayerConstituentCountVector;
 
     /**
      *  @brief  ClusterParameters class
@@ -114,6 +116,15 @@ public:
         ClusterParameters(const pandora::Cluster *const pCluster, const unsigned int numCaloHits, const float totalWeight,
             const ConstituentHitVector &constituentHitVector, const pandora::CartesianVector &lowerXExtrema, const pandora::CartesianVector &higherXExtrema);
 
+        /**
+         *  @brief  Constructor for the cluster formed by a merge, combining the constituent hits of the two clusters in the order that
+         *          the merged cluster ordered calo hit list would give, so that the parameters are identical to those of a rebuild
+         *
+         *  @param  enlargeParameters the parameters of the cluster to be enlarged
+         *  @param  deleteParameters the parameters of the cluster to be deleted
+         */
+        ClusterParameters(const ClusterParameters &enlargeParameters, const ClusterParameters &deleteParameters);
+
         /**
          *  @brief  Returns the address of the cluster
          */
@@ -134,6 +145,11 @@ public:
          */
         const ConstituentHitVector& GetConstituentHitVector() const;
 
+        /**
+         *  @brief  Returns the number of constituent hits in each pseudo layer, in increasing pseudo layer order (empty if not known)
+         */
+        const LayerConstituentCountVector& GetLayerConstituentCounts() const;
+
         /**
          *  @brief  Returns the lower x extremal point of the constituent hits
          */
@@ -148,6 +164,7 @@ public:
         const pandora::Cluster           *m_pCluster;               ///< The address of the cluster
         const unsigned int                m_numCaloHits;            ///< The number of calo hits within the cluster
         const ConstituentHitVector        m_constituentHitVector;   ///< The vector of constituent hits
+        const LayerConstituentCountVector m_layerConstituentCounts; ///< The number of constituent hits in each pseudo layer
         const float                       m_totalWeight;            ///< The total hit weight of the contituent hits
         const pandora::CartesianVector    m_lowerXExtrema;          ///< The lower x extremal point of the constituent hits
         const pandora::CartesianVector    m_higherXExtrema;         ///< The higher x extremal point of the constituent hits
@@ -230,6 +247,40 @@ public:
     static void SplitHitIntoConstituents(const pandora::CaloHit *const pCaloHit, const pandora::Cluster *const pCluster, const unsigned int numberOfConstituentHits,
         const float constituentHitWidth, ConstituentHitVector &constituentHitVector);
 
+    /**
+     *  @brief  Get the number of constituent hits that GetConstituentHits gives for each pseudo layer of a cluster
+     *
+     *  @param  pCluster the input cluster
+     *  @param  maxConstituentHitWidth the maximum width of a constituent hit
+     *  @param  hitWidthScalingFactor the constituent hit width scaling factor
+     *
+     *  @return  the pseudo layers and constituent hit counts, in increasing pseudo layer order
+     */
+    static LayerConstituentCountVector GetLayerConstituentCounts(const pandora::Cluster *const pCluster, const float maxConstituentHitWidth,
+        const float hitWidthScalingFactor);
+
+    /**
+     *  @brief  Combine the constituent hits of two clusters, assigning them to a single parent cluster. The hits are ordered as in the
+     *          ordered calo hit list of the merged cluster: by pseudo layer and, within a pseudo layer, those of the enlarged cluster first.
+     *
+     *  @param  enlargeParameters the parameters of the cluster to be enlarged
+     *  @param  deleteParameters the parameters of the cluster to be deleted
+     *
+     *  @return  the combined vector of constituent hits
+     */
+    static ConstituentHitVector GetMergedConstituentHits(const ClusterParameters &enlargeParameters, const ClusterParameters &deleteParameters);
+
+    /**
+     *  @brief  Combine the numbers of constituent hits in each pseudo layer of two clusters
+     *
+     *  @param  firstCounts the first pseudo layers and constituent hit counts
+     *  @param  secondCounts the second pseudo layers and constituent hit counts
+     *
+     *  @return  the combined pseudo layers and constituent hit counts, in increasing pseudo layer order
+     */
+    static LayerConstituentCountVector GetMergedLayerConstituentCounts(const LayerConstituentCountVector &firstCounts,
+        const LayerConstituentCountVector &secondCounts);
+
     /**
      *  @brief  Obtain a vector of the contituent hit central positions
      *
@@ -360,6 +411,13 @@ inline const LArHitWidthHelper::ConstituentHitVector& LArHitWidthHelper::Cluster
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline const LArHitWidthHelper::LayerConstituentCountVector& LArHitWidthHelper::ClusterParameters::GetLayerConstituentCounts() const
+{
+    return m_layerConstituentCounts;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline const pandora::CartesianVector& LArHitWidthHelper::ClusterParameters::GetLowerXExtrema() const
 {
     return m_lowerXExtrema;
@@ -9,6 +9,7 @@
 #define LAR_MVA_HELPER_H 1
 
 #include "larpandoracontent/LArObjects/LArMvaInterface.h"
+#include "larpandoracontent/LArObjects/LArTrainingExampleSink.h"
 
 #include "Pandora/AlgorithmTool.h"
 #include "Pandora/StatusCodes.h"
@@ -58,9 +59,20 @@ public:
     typedef MvaTypes::MvaFeatureVector MvaFeatureVector;
 
     /**
-     *  @brief  Produce a training example with the given features and result
+     *  @brief  TrainingOutputFormat enum
+     */
+    enum TrainingOutputFormat
+    {
+        TEXT_OUTPUT,                ///< Write examples to the named text file only
+        TEXT_AND_BINARY_OUTPUT      ///< Also write examples to a binary file, named by appending ".bin" to the text file name
+    };
+
+    /**
+     *  @brief  Produce a training example with the given features and result. Examples are buffered and appended to the file in blocks
+     *          and at each call to FlushTrainingExamples.
      *
      *  @param  trainingOutputFile the file to which to append the example
+     *  @param  result the result
      *  @param  featureLists the lists of features
      *
      *  @return success
@@ -68,6 +80,28 @@ public:
     template <typename ...TLISTS>
     static pandora::StatusCode ProduceTrainingExample(const std::string &trainingOutputFile, const bool result, TLISTS &&... featureLists);
 
+    /**
+     *  @brief  Produce a training example with the given features and result, in the given output format. Examples are buffered and
+     *          appended to the files in blocks and at each call to FlushTrainingExamples.
+     *
+     *  @param  trainingOutputFile the text file to which to append the example
+     *  @param  outputFormat the output format
+     *  @param  result the result
+     *  @param  featureLists the lists of features
+     *
+     *  @return success
+     */
+    template <typename ...TLISTS>
+    static pandora::StatusCode ProduceTrainingExample(const std::string &trainingOutputFile, const TrainingOutputFormat outputFormat,
+        const bool result, TLISTS &&... featureLists);
+
+    /**
+     *  @brief  Write any buffered training examples to their files, to be called once the examples for an event have been produced
+     *
+     *  @return success, or failure if any output file could not be written
+     */
+    static pandora::StatusCode FlushTrainingExamples();
+
     /**
      *  @brief  Use the trained classifier to predict the boolean class of an example
      *
@@ -135,45 +169,6 @@ public:
     static pandora::StatusCode AddFeatureToolToVector(pandora::AlgorithmTool *const pFeatureTool, MvaFeatureToolVector<Ts...> &featureToolVector);
 
 private:
-    /**
-     *  @brief  Get a timestamp string for this point in time
-     *
-     *  @return a timestamp string
-     */
-    static std::string GetTimestampString();
-
-    /**
-     *  @brief  Recursively write the features of the given lists to file
-     *
-     *  @param  outfile the std::ofstream object to use
-     *  @param  delimiter the delimiter string
-     *  @param  featureList a list of features to write
-     *  @param  featureLists optional further lists of features to write
-     *
-     *  @return success
-     */
-    template <typename TLIST, typename ...TLISTS>
-    static pandora::StatusCode WriteFeaturesToFile(std::ofstream &outfile, const std::string &delimiter, TLIST &&featureList, TLISTS &&... featureLists);
-
-    /**
-     *  @brief  Recursively write the features of the given lists to file (terminating method)
-     *
-     *  @return success
-     */
-    static pandora::StatusCode WriteFeaturesToFile(std::ofstream &, const std::string &);
-
-    /**
-     *  @brief  Write the features of the given list to file (implementation method)
-     *
-     *  @param  outfile the std::ofstream object to use
-     *  @param  delimiter the delimiter string
-     *  @param  featureList a list of features to write
-     *
-     *  @return success
-     */
-    template <typename TLIST>
-    static pandora::StatusCode WriteFeaturesToFileImpl(std::ofstream &outfile, const std::string &delimiter, TLIST &&featureList);
-
     /**
      *  @brief  Recursively concatenate vectors of features
      *
@@ -196,22 +191,24 @@ private:
 template <typename ...TLISTS>
 pandora::StatusCode LArMvaHelper::ProduceTrainingExample(const std::string &trainingOutputFile, const bool result, TLISTS &&... featureLists)
 {
-    std::ofstream outfile;
-    outfile.open(trainingOutputFile, std::ios_base::app); // always append to the output file
+    return ProduceTrainingExample(trainingOutputFile, TEXT_OUTPUT, result, std::forward<TLISTS>(featureLists)...);
+}
 
-    if (!outfile.is_open())
-    {
-        std::cout << "LArMvaHelper: could not open file for training examples at " << trainingOutputFile << std::endl;
-        return pandora::STATUS_CODE_FAILURE;
-    }
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    std::string delimiter(",");
-    outfile << GetTimestampString() << delimiter;
+template <typename ...TLISTS>
+pandora::StatusCode LArMvaHelper::ProduceTrainingExample(const std::string &trainingOutputFile, const TrainingOutputFormat outputFormat,
+    const bool result, TLISTS &&... featureLists)
+{
+    return TrainingExampleSink::AddExample(trainingOutputFile, ConcatenateFeatureLists(std::forward<TLISTS>(featureLists)...), result,
+        TEXT_AND_BINARY_OUTPUT == outputFormat);
+}
 
-    PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, WriteFeaturesToFile(outfile, delimiter, featureLists...));
-    outfile << static_cast<int>(result) << '\n';
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    return pandora::STATUS_CODE_SUCCESS;
+inline pandora::StatusCode LArMvaHelper::FlushTrainingExamples()
+{
+    return TrainingExampleSink::FlushAll();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -284,56 +281,6 @@ pandora::StatusCode LArMvaHelper::AddFeatureToolToVector(pandora::AlgorithmTool
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline std::string LArMvaHelper::GetTimestampString()
-{
-    std::time_t timestampNow = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-
-    struct tm *pTimeInfo(NULL);
-    char buffer[80];
-
-    pTimeInfo = localtime(&timestampNow);
-    strftime(buffer, 80, "%x_%X", pTimeInfo);
-
-    std::string timeString(buffer);
-
-    if (!timeString.empty() && timeString.back() == '\n') // last char is always a newline
-        timeString.pop_back();
-
-    return timeString;
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-template <typename TLIST, typename ...TLISTS>
-inline pandora::StatusCode LArMvaHelper::WriteFeaturesToFile(std::ofstream &outfile, const std::string &delimiter, TLIST &&featureList, TLISTS &&... featureLists)
-{
-    static_assert(std::is_same<typename std::decay<TLIST>::type, LArMvaHelper::MvaFeatureVector>::value,
-        "LArMvaHelper: Could not write training set example because a passed parameter was not a vector of MvaFeatures");
-
-    PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, WriteFeaturesToFileImpl(outfile, delimiter, featureList));
-    return WriteFeaturesToFile(outfile, delimiter, featureLists...);
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-inline pandora::StatusCode LArMvaHelper::WriteFeaturesToFile(std::ofstream &, const std::string &)
-{
-    return pandora::STATUS_CODE_SUCCESS;
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-template <typename TLIST>
-pandora::StatusCode LArMvaHelper::WriteFeaturesToFileImpl(std::ofstream &outfile, const std::string &delimiter, TLIST &&featureList)
-{
-    for (const MvaFeature feature : featureList)
-        outfile << feature.Get() << delimiter;
-
-    return pandora::STATUS_CODE_SUCCESS;
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 template <typename TLIST, typename ...TLISTS>
 LArMvaHelper::MvaFeatureVector LArMvaHelper::ConcatenateFeatureLists(TLIST &&featureList, TLISTS &&... featureLists)
 {
@@ -0,0 +1,169 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArParallelHelper.h
+ *
+ *  @brief  Header file for the parallel helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PARALLEL_HELPER_H
+#define LAR_PARALLEL_HELPER_H 1
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArParallelHelper class
+ *
+ *  ATTN The Pandora content API is not thread safe. Functions passed to this helper must only perform calculations on inputs that are not
+ *  modified for the duration of the call, e.g. fits to existing clusters, and must write only to storage owned by the item index.
+ */
+class LArParallelHelper
+{
+public:
+    typedef std::vector<std::pair<const pandora::Cluster*, pandora::StatusCode>> ClusterFailureList;
+
+    /**
+     *  @brief  Apply a function to each item index in the range [0, nItems), distributing the items over a number of threads
+     *
+     *  @param  nItems the number of items
+     *  @param  nThreads the maximum number of threads, with values of zero or one giving serial processing on the calling thread
+     *  @param  function the function to apply, taking the item index
+     *
+     *  @throws any exception thrown by the function; if several items throw, the exception for the lowest item index is rethrown
+     */
+    template <typename TFUNCTION>
+    static void ForEach(const std::size_t nItems, const unsigned int nThreads, const TFUNCTION &function);
+
+    /**
+     *  @brief  Construct a fit result for each cluster in a vector, distributing the fits over a number of threads. A pandora status code
+     *          exception raised for an individual cluster is captured and reported, without affecting the fits to the other clusters.
+     *
+     *  @param  clusterVector the clusters to fit
+     *  @param  nThreads the maximum number of threads, with values of zero or one giving serial processing on the calling thread
+     *  @param  fitFunction the function taking a cluster address and returning its fit result
+     *  @param  fitResultMap to receive the fit results, keyed by cluster
+     *  @param  failureList to receive the clusters for which the fit failed, with the status code, in the order of the input vector
+     */
+    template <typename TFIT, typename TFUNCTION>
+    static void FitClusters(const pandora::ClusterVector &clusterVector, const unsigned int nThreads, const TFUNCTION &fitFunction,
+        std::unordered_map<const pandora::Cluster*, TFIT> &fitResultMap, ClusterFailureList &failureList);
+
+    /**
+     *  @brief  Get the number of threads to use for a given number of items, limited by the requested and available concurrency
+     *
+     *  @param  nItems the number of items
+     *  @param  nThreads the maximum number of threads
+     *
+     *  @return the number of threads
+     */
+    static unsigned int GetNThreads(const std::size_t nItems, const unsigned int nThreads);
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TFUNCTION>
+void LArParallelHelper::ForEach(const std::size_t nItems, const unsigned int nThreads, const TFUNCTION &function)
+{
+    const unsigned int nWorkers(LArParallelHelper::GetNThreads(nItems, nThreads));
+
+    if (nWorkers < 2)
+    {
+        for (std::size_t index = 0; index < nItems; ++index)
+            function(index);
+
+        return;
+    }
+
+    std::atomic<std::size_t> nextIndex(0);
+    std::vector<std::exception_ptr> exceptionVector(nItems);
+
+    auto worker = [&]() {
+        for (std::size_t index = nextIndex++; index < nItems; index = nextIndex++)
+        {
+            try
+            {
+                function(index);
+            }
+            catch (...)
+            {
+                exceptionVector.at(index) = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threadVector;
+    threadVector.reserve(nWorkers - 1);
+
+    for (unsigned int iThread = 1; iThread < nWorkers; ++iThread)
+        threadVector.emplace_back(worker);
+
+    worker();
+
+    for (std::thread &thread : threadVector)
+        thread.join();
+
+    for (const std::exception_ptr &exception : exceptionVector)
+    {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TFIT, typename TFUNCTION>
+void LArParallelHelper::FitClusters(const pandora::ClusterVector &clusterVector, const unsigned int nThreads, const TFUNCTION &fitFunction,
+    std::unordered_map<const pandora::Cluster*, TFIT> &fitResultMap, ClusterFailureList &failureList)
+{
+    std::vector<std::unique_ptr<TFIT>> fitResults(clusterVector.size());
+    std::vector<pandora::StatusCode> statusCodes(clusterVector.size(), pandora::STATUS_CODE_SUCCESS);
+
+    LArParallelHelper::ForEach(clusterVector.size(), nThreads, [&](const std::size_t index) {
+        try
+        {
+            fitResults.at(index) = std::make_unique<TFIT>(fitFunction(clusterVector.at(index)));
+        }
+        catch (const pandora::StatusCodeException &statusCodeException)
+        {
+            statusCodes.at(index) = statusCodeException.GetStatusCode();
+        }
+    });
+
+    // ATTN Results are collected on the calling thread, in the order of the input vector
+    for (std::size_t index = 0; index < clusterVector.size(); ++index)
+    {
+        const pandora::Cluster *const pCluster(clusterVector.at(index));
+
+        if (fitResults.at(index))
+        {
+            (void)fitResultMap.insert(typename std::unordered_map<const pandora::Cluster*, TFIT>::value_type(pCluster, std::move(*fitResults.at(index))));
+        }
+        else
+        {
+            failureList.emplace_back(pCluster, statusCodes.at(index));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int LArParallelHelper::GetNThreads(const std::size_t nItems, const unsigned int nThreads)
+{
+    const unsigned int nHardwareThreads(std::max(1u, std::thread::hardware_concurrency()));
+    return static_cast<unsigned int>(std::min<std::size_t>(nItems, std::min(nThreads, nHardwareThreads)));
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PARALLEL_HELPER_H
@@ -140,7 +140,321 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArPcaHelper::RunPca(const MomentAccumulator &momentAccumulator, CartesianVector &centroid, EigenValues &outputEigenValues,
+    EigenVectors &outputEigenVectors)
+{
+    if (momentAccumulator.GetSumWeight() < std::numeric_limits<double>::epsilon())
+    {
+        std::cout << "LArPcaHelper::RunPca - sum of weights is zero" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+    }
+
+    centroid = momentAccumulator.GetCentroid();
+
+    double covariance[6];
+    momentAccumulator.GetCovariance(covariance);
+
+    double eigenValues[3], eigenVectors[3][3];
+    LArPcaHelper::GetSymmetricEigenSystem(covariance, eigenValues, eigenVectors);
+
+    outputEigenValues = CartesianVector(eigenValues[0], eigenValues[1], eigenValues[2]);
+
+    for (unsigned int i = 0; i < 3; ++i)
+        outputEigenVectors.emplace_back(eigenVectors[i][0], eigenVectors[i][1], eigenVectors[i][2]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::GetSymmetricEigenSystem(const double matrix[6], double eigenValues[3], double eigenVectors[3][3])
+{
+    // Scale by the largest element, to avoid overflow and underflow
+    double maxAbsElement(0.);
+
+    for (unsigned int i = 0; i < 6; ++i)
+        maxAbsElement = std::max(maxAbsElement, std::fabs(matrix[i]));
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        for (unsigned int j = 0; j < 3; ++j)
+            eigenVectors[i][j] = ((i == j) ? 1. : 0.);
+    }
+
+    if (maxAbsElement < std::numeric_limits<double>::min())
+    {
+        eigenValues[0] = eigenValues[1] = eigenValues[2] = 0.;
+        return;
+    }
+
+    double a[6];
+
+    for (unsigned int i = 0; i < 6; ++i)
+        a[i] = matrix[i] / maxAbsElement;
+
+    // Eigen values from the roots of the characteristic polynomial of the shifted and scaled matrix b = (a - q * 1) / p
+    const double q((a[0] + a[3] + a[5]) / 3.);
+    const double offDiagonal(a[1] * a[1] + a[2] * a[2] + a[4] * a[4]);
+    const double p2((a[0] - q) * (a[0] - q) + (a[3] - q) * (a[3] - q) + (a[5] - q) * (a[5] - q) + 2. * offDiagonal);
+
+    if (p2 <= 0.)
+    {
+        eigenValues[0] = eigenValues[1] = eigenValues[2] = q * maxAbsElement;
+        return;
+    }
+
+    const double p(std::sqrt(p2 / 6.));
+    const double b[6] = {(a[0] - q) / p, a[1] / p, a[2] / p, (a[3] - q) / p, a[4] / p, (a[5] - q) / p};
+    const double halfDeterminant(0.5 * (b[0] * (b[3] * b[5] - b[4] * b[4]) - b[1] * (b[1] * b[5] - b[4] * b[2]) + b[2] * (b[1] * b[4] - b[3] * b[2])));
+    const double phi(std::acos(std::max(-1., std::min(1., halfDeterminant))) / 3.);
+
+    const double largestEigenValue(q + 2. * p * std::cos(phi));
+    const double smallestEigenValue(q + 2. * p * std::cos(phi + 2. * M_PI / 3.));
+    const double middleEigenValue(3. * q - largestEigenValue - smallestEigenValue);
+
+    // ATTN The trigonometric solution loses relative precision for eigen values much smaller than the largest, so it is only used to
+    // find the eigen vector for the most distinct eigen value. The other two come from the exact 2x2 problem in the orthogonal plane.
+    const bool isLargestDistinct((largestEigenValue - middleEigenValue) >= (middleEigenValue - smallestEigenValue));
+
+    double vectors[3][3], values[3];
+    LArPcaHelper::GetDistinctEigenVector(a, isLargestDistinct ? largestEigenValue : smallestEigenValue, vectors[0]);
+    LArPcaHelper::GetOrthogonalEigenSystem(a, vectors[0], &values[1], &vectors[1]);
+
+    const double *const v(vectors[0]);
+    values[0] = a[0] * v[0] * v[0] + a[3] * v[1] * v[1] + a[5] * v[2] * v[2] + 2. * (a[1] * v[0] * v[1] + a[2] * v[0] * v[2] + a[4] * v[1] * v[2]);
+
+    unsigned int order[3] = {0, 1, 2};
+    std::sort(order, order + 3, [&values](const unsigned int lhs, const unsigned int rhs){return values[lhs] > values[rhs];});
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        eigenValues[i] = values[order[i]] * maxAbsElement;
+
+        for (unsigned int j = 0; j < 3; ++j)
+            eigenVectors[i][j] = vectors[order[i]][j];
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::GetDistinctEigenVector(const double matrix[6], const double eigenValue, double eigenVector[3])
+{
+    // The rows of (matrix - eigenValue * 1) span the plane orthogonal to the eigen vector, so use their largest cross product
+    const double rows[3][3] = {{matrix[0] - eigenValue, matrix[1], matrix[2]}, {matrix[1], matrix[3] - eigenValue, matrix[4]},
+        {matrix[2], matrix[4], matrix[5] - eigenValue}};
+    const unsigned int rowPairs[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+
+    double bestMagnitudeSquared(0.);
+    eigenVector[0] = 1.;
+    eigenVector[1] = 0.;
+    eigenVector[2] = 0.;
+
+    for (const auto &rowPair : rowPairs)
+    {
+        const double *const r0(rows[rowPair[0]]), *const r1(rows[rowPair[1]]);
+        const double cross[3] = {r0[1] * r1[2] - r0[2] * r1[1], r0[2] * r1[0] - r0[0] * r1[2], r0[0] * r1[1] - r0[1] * r1[0]};
+        const double magnitudeSquared(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]);
+
+        if (magnitudeSquared > bestMagnitudeSquared)
+        {
+            bestMagnitudeSquared = magnitudeSquared;
+            eigenVector[0] = cross[0];
+            eigenVector[1] = cross[1];
+            eigenVector[2] = cross[2];
+        }
+    }
+
+    if (bestMagnitudeSquared > 0.)
+    {
+        const double magnitude(std::sqrt(bestMagnitudeSquared));
+        eigenVector[0] /= magnitude;
+        eigenVector[1] /= magnitude;
+        eigenVector[2] /= magnitude;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::GetOrthogonalEigenSystem(const double matrix[6], const double knownEigenVector[3], double eigenValues[2], double eigenVectors[2][3])
+{
+    // Orthonormal basis u, v for the plane orthogonal to the known eigen vector w
+    const double *const w(knownEigenVector);
+    double u[3];
+
+    if (std::fabs(w[0]) > std::fabs(w[1]))
+    {
+        const double norm(1. / std::sqrt(w[0] * w[0] + w[2] * w[2]));
+        u[0] = -w[2] * norm;
+        u[1] = 0.;
+        u[2] = w[0] * norm;
+    }
+    else
+    {
+        const double norm(1. / std::sqrt(w[1] * w[1] + w[2] * w[2]));
+        u[0] = 0.;
+        u[1] = w[2] * norm;
+        u[2] = -w[1] * norm;
+    }
+
+    const double v[3] = {w[1] * u[2] - w[2] * u[1], w[2] * u[0] - w[0] * u[2], w[0] * u[1] - w[1] * u[0]};
+
+    // The matrix restricted to the plane, in the u, v basis
+    const double au[3] = {matrix[0] * u[0] + matrix[1] * u[1] + matrix[2] * u[2], matrix[1] * u[0] + matrix[3] * u[1] + matrix[4] * u[2],
+        matrix[2] * u[0] + matrix[4] * u[1] + matrix[5] * u[2]};
+    const double av[3] = {matrix[0] * v[0] + matrix[1] * v[1] + matrix[2] * v[2], matrix[1] * v[0] + matrix[3] * v[1] + matrix[4] * v[2],
+        matrix[2] * v[0] + matrix[4] * v[1] + matrix[5] * v[2]};
+
+    const double m00(u[0] * au[0] + u[1] * au[1] + u[2] * au[2]);
+    const double m01(u[0] * av[0] + u[1] * av[1] + u[2] * av[2]);
+    const double m11(v[0] * av[0] + v[1] * av[1] + v[2] * av[2]);
+
+    // Diagonalize with a single Jacobi rotation, choosing the smaller rotation angle for stability
+    double t(0.);
+
+    if (std::fabs(m01) > 0.)
+    {
+        const double tau((m11 - m00) / (2. * m01));
+        t = ((tau >= 0.) ? 1. : -1.) / (std::fabs(tau) + std::sqrt(1. + tau * tau));
+    }
+
+    const double c(1. / std::sqrt(1. + t * t)), s(t * c);
+
+    eigenValues[0] = m00 - t * m01;
+    eigenValues[1] = m11 + t * m01;
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        eigenVectors[0][i] = c * u[i] - s * v[i];
+        eigenVectors[1][i] = s * u[i] + c * v[i];
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArPcaHelper::MomentAccumulator::MomentAccumulator() :
+    m_sumWeight(0.),
+    m_mean{0., 0., 0.},
+    m_comoment{0., 0., 0., 0., 0., 0.}
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void LArPcaHelper::MomentAccumulator::AddPoints(const T &t)
+{
+    for (const auto &point : t)
+        this->AddPoint(LArObjectHelper::TypeAdaptor::GetPosition(point));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::MomentAccumulator::AddPoint(const CartesianVector &point, const double weight)
+{
+    if (weight < 0.)
+    {
+        std::cout << "LArPcaHelper::MomentAccumulator - negative weight found" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+    }
+
+    if (weight <= 0.)
+        return;
+
+    const double newSumWeight(m_sumWeight + weight);
+    const double delta[3] = {point.GetX() - m_mean[0], point.GetY() - m_mean[1], point.GetZ() - m_mean[2]};
+    const double factor(weight * m_sumWeight / newSumWeight);
+
+    for (unsigned int i = 0; i < 3; ++i)
+        m_mean[i] += delta[i] * weight / newSumWeight;
+
+    m_comoment[0] += factor * delta[0] * delta[0];
+    m_comoment[1] += factor * delta[0] * delta[1];
+    m_comoment[2] += factor * delta[0] * delta[2];
+    m_comoment[3] += factor * delta[1] * delta[1];
+    m_comoment[4] += factor * delta[1] * delta[2];
+    m_comoment[5] += factor * delta[2] * delta[2];
+    m_sumWeight = newSumWeight;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::MomentAccumulator::RemovePoint(const CartesianVector &point, const double weight)
+{
+    if (weight < 0.)
+    {
+        std::cout << "LArPcaHelper::MomentAccumulator - negative weight found" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+    }
+
+    if (weight <= 0.)
+        return;
+
+    const double newSumWeight(m_sumWeight - weight);
+
+    if (newSumWeight < std::numeric_limits<double>::epsilon())
+    {
+        *this = MomentAccumulator();
+        return;
+    }
+
+    // Inverse of the update in AddPoint, as the deviation from the new mean is the deviation from the old mean scaled by the weight ratio
+    const double delta[3] = {point.GetX() - m_mean[0], point.GetY() - m_mean[1], point.GetZ() - m_mean[2]};
+    const double factor(weight * m_sumWeight / newSumWeight);
+
+    for (unsigned int i = 0; i < 3; ++i)
+        m_mean[i] -= delta[i] * weight / newSumWeight;
+
+    m_comoment[0] -= factor * delta[0] * delta[0];
+    m_comoment[1] -= factor * delta[0] * delta[1];
+    m_comoment[2] -= factor * delta[0] * delta[2];
+    m_comoment[3] -= factor * delta[1] * delta[1];
+    m_comoment[4] -= factor * delta[1] * delta[2];
+    m_comoment[5] -= factor * delta[2] * delta[2];
+    m_sumWeight = newSumWeight;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::MomentAccumulator::Merge(const MomentAccumulator &other)
+{
+    if (other.m_sumWeight <= 0.)
+        return;
+
+    if (m_sumWeight <= 0.)
+    {
+        *this = other;
+        return;
+    }
+
+    const double newSumWeight(m_sumWeight + other.m_sumWeight);
+    const double delta[3] = {other.m_mean[0] - m_mean[0], other.m_mean[1] - m_mean[1], other.m_mean[2] - m_mean[2]};
+    const double factor(m_sumWeight * other.m_sumWeight / newSumWeight);
+
+    for (unsigned int i = 0; i < 3; ++i)
+        m_mean[i] += delta[i] * other.m_sumWeight / newSumWeight;
+
+    m_comoment[0] += other.m_comoment[0] + factor * delta[0] * delta[0];
+    m_comoment[1] += other.m_comoment[1] + factor * delta[0] * delta[1];
+    m_comoment[2] += other.m_comoment[2] + factor * delta[0] * delta[2];
+    m_comoment[3] += other.m_comoment[3] + factor * delta[1] * delta[1];
+    m_comoment[4] += other.m_comoment[4] + factor * delta[1] * delta[2];
+    m_comoment[5] += other.m_comoment[5] + factor * delta[2] * delta[2];
+    m_sumWeight = newSumWeight;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::MomentAccumulator::GetCovariance(double covariance[6]) const
+{
+    for (unsigned int i = 0; i < 6; ++i)
+        covariance[i] = ((m_sumWeight > 0.) ? m_comoment[i] / m_sumWeight : 0.);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template void LArPcaHelper::RunPca(const CartesianPointVector &, CartesianVector &, EigenValues &, EigenVectors &);
 template void LArPcaHelper::RunPca(const CaloHitList &, CartesianVector &, EigenValues &, EigenVectors &);
 
+template void LArPcaHelper::MomentAccumulator::AddPoints(const CartesianPointVector &);
+template void LArPcaHelper::MomentAccumulator::AddPoints(const CaloHitList &);
+
 } // namespace lar_content
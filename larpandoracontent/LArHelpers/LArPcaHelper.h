@@ -24,6 +24,78 @@ public:
     typedef std::pair<const pandora::CartesianVector, double> WeightedPoint;
     typedef std::vector<WeightedPoint> WeightedPointVector;
 
+    /**
+     *  @brief  MomentAccumulator class, holding the sum of weights, the weighted mean and the weighted second central moments of a set of
+     *          points in double precision. Points can be added and removed, and two accumulators merged, in constant time, using the
+     *          updates of Welford and of Chan et al., which avoid the cancellation of accumulating raw second moments.
+     */
+    class MomentAccumulator
+    {
+    public:
+        /**
+         *  @brief  Default constructor, for an empty set of points
+         */
+        MomentAccumulator();
+
+        /**
+         *  @brief  Add the positions of input calo hits or points (TPC_VIEW_U,V,W or TPC_3D; all treated as 3D points), with unit weight
+         *
+         *  @param  t the input information
+         */
+        template <typename T>
+        void AddPoints(const T &t);
+
+        /**
+         *  @brief  Add a point
+         *
+         *  @param  point the position of the point
+         *  @param  weight the non-negative weight of the point
+         */
+        void AddPoint(const pandora::CartesianVector &point, const double weight = 1.);
+
+        /**
+         *  @brief  Remove a point, previously added with the same position and weight. Precision is lost if the point dominates the
+         *          moments of the points that remain.
+         *
+         *  @param  point the position of the point
+         *  @param  weight the non-negative weight of the point
+         */
+        void RemovePoint(const pandora::CartesianVector &point, const double weight = 1.);
+
+        /**
+         *  @brief  Add all of the points held by another accumulator
+         *
+         *  @param  other the other accumulator
+         */
+        void Merge(const MomentAccumulator &other);
+
+        /**
+         *  @brief  Get the sum of the weights of the points
+         *
+         *  @return the sum of weights
+         */
+        double GetSumWeight() const;
+
+        /**
+         *  @brief  Get the weighted mean position of the points
+         *
+         *  @return the weighted mean position
+         */
+        pandora::CartesianVector GetCentroid() const;
+
+        /**
+         *  @brief  Get the weighted covariance matrix of the points
+         *
+         *  @param  covariance to receive the matrix elements xx, xy, xz, yy, yz and zz
+         */
+        void GetCovariance(double covariance[6]) const;
+
+    private:
+        double      m_sumWeight;        ///< The sum of the weights of the points
+        double      m_mean[3];          ///< The weighted mean position of the points
+        double      m_comoment[6];      ///< The weighted sums of products of deviations from the mean, in order xx, xy, xz, yy, yz and zz
+    };
+
     /**
      *  @brief  Run principal component analysis using input calo hits (TPC_VIEW_U,V,W or TPC_3D; all treated as 3D points)
      *
@@ -45,8 +117,69 @@ public:
      */
     static void RunPca(const WeightedPointVector &pointVector, pandora::CartesianVector &centroid, EigenValues &outputEigenValues,
         EigenVectors &outputEigenVectors);
+
+    /**
+     *  @brief  Run principal component analysis using the moments held by an accumulator, without revisiting the points, so that the
+     *          accumulators for clusters or pfos can be merged to analyse their union
+     *
+     *  @param  momentAccumulator the moment accumulator
+     *  @param  centroid to receive the centroid position
+     *  @param  outputEigenValues to receive the eigen values
+     *  @param  outputEigenVectors to receive the eigen vectors
+     */
+    static void RunPca(const MomentAccumulator &momentAccumulator, pandora::CartesianVector &centroid, EigenValues &outputEigenValues,
+        EigenVectors &outputEigenVectors);
+
+    /**
+     *  @brief  Get the eigen values and eigen vectors of a real symmetric 3x3 matrix in closed form. The trigonometric solution of the
+     *          characteristic cubic identifies the most distinct eigen value, whose eigen vector is found from cross products of the rows
+     *          of the shifted matrix, and a single rotation diagonalizes the matrix in the orthogonal plane. This is robust to repeated
+     *          eigen values, and small eigen values keep their accuracy relative to the largest matrix element.
+     *
+     *  @param  matrix the matrix elements xx, xy, xz, yy, yz and zz
+     *  @param  eigenValues to receive the eigen values, in decreasing order
+     *  @param  eigenVectors to receive the corresponding unit eigen vectors, which form an orthonormal basis
+     */
+    static void GetSymmetricEigenSystem(const double matrix[6], double eigenValues[3], double eigenVectors[3][3]);
+
+private:
+    /**
+     *  @brief  Get the unit eigen vector for an eigen value of a real symmetric 3x3 matrix, which must be well separated from the other
+     *          two eigen values
+     *
+     *  @param  matrix the matrix elements xx, xy, xz, yy, yz and zz
+     *  @param  eigenValue the eigen value
+     *  @param  eigenVector to receive the unit eigen vector
+     */
+    static void GetDistinctEigenVector(const double matrix[6], const double eigenValue, double eigenVector[3]);
+
+    /**
+     *  @brief  Get the other two eigen values and unit eigen vectors of a real symmetric 3x3 matrix, given one unit eigen vector, by
+     *          diagonalizing the matrix restricted to the orthogonal plane
+     *
+     *  @param  matrix the matrix elements xx, xy, xz, yy, yz and zz
+     *  @param  knownEigenVector the known unit eigen vector
+     *  @param  eigenValues to receive the two eigen values
+     *  @param  eigenVectors to receive the corresponding unit eigen vectors
+     */
+    static void GetOrthogonalEigenSystem(const double matrix[6], const double knownEigenVector[3], double eigenValues[2], double eigenVectors[2][3]);
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArPcaHelper::MomentAccumulator::GetSumWeight() const
+{
+    return m_sumWeight;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::CartesianVector LArPcaHelper::MomentAccumulator::GetCentroid() const
+{
+    return pandora::CartesianVector(m_mean[0], m_mean[1], m_mean[2]);
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_PCA_HELPER_H
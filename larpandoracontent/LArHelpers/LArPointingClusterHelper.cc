@@ -323,6 +323,175 @@ void LArPointingClusterHelper::GetIntersection(const LArPointingCluster::Vertex
 	throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPointingClusterHelper::GetImpactParameters(const LArPointingClusterArrays::VertexArrays &pointingVertices,
+    const CartesianVector &targetPosition, FloatVector &longitudinal, FloatVector &transverse)
+{
+    const std::size_t nVertices(pointingVertices.m_positionX.size());
+    longitudinal.resize(nVertices);
+    transverse.resize(nVertices);
+
+    const float targetX(targetPosition.GetX()), targetY(targetPosition.GetY()), targetZ(targetPosition.GetZ());
+    const float *const pPositionX(pointingVertices.m_positionX.data());
+    const float *const pPositionY(pointingVertices.m_positionY.data());
+    const float *const pPositionZ(pointingVertices.m_positionZ.data());
+    const float *const pDirectionX(pointingVertices.m_directionX.data());
+    const float *const pDirectionY(pointingVertices.m_directionY.data());
+    const float *const pDirectionZ(pointingVertices.m_directionZ.data());
+    float *const pLongitudinal(longitudinal.data());
+    float *const pTransverse(transverse.data());
+
+    // ATTN Operations are in the same order as for the CartesianVector cross and dot products, so results match the scalar function
+    for (std::size_t i = 0; i < nVertices; ++i)
+    {
+        const float dx(targetX - pPositionX[i]), dy(targetY - pPositionY[i]), dz(targetZ - pPositionZ[i]);
+        const float crossX(pDirectionY[i] * dz - dy * pDirectionZ[i]);
+        const float crossY(pDirectionZ[i] * dx - dz * pDirectionX[i]);
+        const float crossZ(pDirectionX[i] * dy - dx * pDirectionY[i]);
+
+        pTransverse[i] = std::sqrt(crossX * crossX + crossY * crossY + crossZ * crossZ);
+        pLongitudinal[i] = -(pDirectionX[i] * dx + pDirectionY[i] * dy + pDirectionZ[i] * dz);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPointingClusterHelper::IsNode(const FloatVector &longitudinal, const FloatVector &transverse, const float minLongitudinalDistance,
+    const float maxTransverseDistance, LArPointingClusterArrays::FlagVector &isNode)
+{
+    const std::size_t nVertices(longitudinal.size());
+
+    if ((transverse.size() != nVertices) || (isNode.size() != nVertices))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const float absMinLongitudinalDistance(std::fabs(minLongitudinalDistance));
+    const float *const pLongitudinal(longitudinal.data());
+    const float *const pTransverse(transverse.data());
+    unsigned char *const pIsNode(isNode.data());
+
+    for (std::size_t i = 0; i < nVertices; ++i)
+        pIsNode[i] |= static_cast<unsigned char>(!((std::fabs(pLongitudinal[i]) > absMinLongitudinalDistance) || (pTransverse[i] > maxTransverseDistance)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPointingClusterHelper::IsEmission(const FloatVector &longitudinal, const FloatVector &transverse, const float minLongitudinalDistance,
+    const float maxLongitudinalDistance, const float maxTransverseDistance, const float angularAllowance, LArPointingClusterArrays::FlagVector &isEmission)
+{
+    const std::size_t nVertices(longitudinal.size());
+
+    if ((transverse.size() != nVertices) || (isEmission.size() != nVertices))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const float absMinLongitudinalDistance(std::fabs(minLongitudinalDistance));
+    const float maxTransverseDistanceSquared(maxTransverseDistance * maxTransverseDistance);
+    const float tanSqTheta(std::pow(std::tan(M_PI * angularAllowance / 180.f), 2.0));
+    const float *const pLongitudinal(longitudinal.data());
+    const float *const pTransverse(transverse.data());
+    unsigned char *const pIsEmission(isEmission.data());
+
+    for (std::size_t i = 0; i < nVertices; ++i)
+    {
+        const float rL(pLongitudinal[i]), rT(pTransverse[i]);
+        const bool isOutsideRange((std::fabs(rL) > absMinLongitudinalDistance) && ((rL < 0) || (rL > maxLongitudinalDistance)));
+        const bool isOutsideCone(rT * rT > maxTransverseDistanceSquared + rL * rL * tanSqTheta);
+        pIsEmission[i] |= static_cast<unsigned char>(!(isOutsideRange || isOutsideCone));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPointingClusterHelper::GetIntersection(const LArPointingCluster::Vertex &firstVertex,
+    const LArPointingClusterArrays::VertexArrays &secondVertices, LArPointingClusterArrays::IntersectionArrays &intersectionArrays)
+{
+    const std::size_t nVertices(secondVertices.m_positionX.size());
+    intersectionArrays.m_positionX.resize(nVertices);
+    intersectionArrays.m_positionY.resize(nVertices);
+    intersectionArrays.m_positionZ.resize(nVertices);
+    intersectionArrays.m_firstDisplacement.resize(nVertices);
+    intersectionArrays.m_secondDisplacement.resize(nVertices);
+    intersectionArrays.m_isValid.resize(nVertices);
+
+    const Cluster *const pFirstCluster(firstVertex.GetCluster());
+    const float a1x(firstVertex.GetPosition().GetX()), a1y(firstVertex.GetPosition().GetY()), a1z(firstVertex.GetPosition().GetZ());
+    const float a2x(firstVertex.GetDirection().GetX()), a2y(firstVertex.GetDirection().GetY()), a2z(firstVertex.GetDirection().GetZ());
+
+    const Cluster *const *const pSecondClusters(secondVertices.m_clusters.data());
+    const float *const pB1x(secondVertices.m_positionX.data());
+    const float *const pB1y(secondVertices.m_positionY.data());
+    const float *const pB1z(secondVertices.m_positionZ.data());
+    const float *const pB2x(secondVertices.m_directionX.data());
+    const float *const pB2y(secondVertices.m_directionY.data());
+    const float *const pB2z(secondVertices.m_directionZ.data());
+
+    float *const pPositionX(intersectionArrays.m_positionX.data());
+    float *const pPositionY(intersectionArrays.m_positionY.data());
+    float *const pPositionZ(intersectionArrays.m_positionZ.data());
+    float *const pFirstDisplacement(intersectionArrays.m_firstDisplacement.data());
+    float *const pSecondDisplacement(intersectionArrays.m_secondDisplacement.data());
+    unsigned char *const pIsValid(intersectionArrays.m_isValid.data());
+
+    // ATTN Entries for parallel vertices are evaluated anyway, keeping the loop free of branches, and then flagged as invalid
+    for (std::size_t i = 0; i < nVertices; ++i)
+    {
+        const float cosTheta(a2x * pB2x[i] + a2y * pB2y[i] + a2z * pB2z[i]);
+        const float dx(pB1x[i] - a1x), dy(pB1y[i] - a1y), dz(pB1z[i] - a1z);
+        const float denominator(1.f - cosTheta * cosTheta);
+
+        const float P(((a2x - pB2x[i] * cosTheta) * dx + (a2y - pB2y[i] * cosTheta) * dy + (a2z - pB2z[i] * cosTheta) * dz) / denominator);
+        const float Q(((a2x * cosTheta - pB2x[i]) * dx + (a2y * cosTheta - pB2y[i]) * dy + (a2z * cosTheta - pB2z[i]) * dz) / denominator);
+
+        pPositionX[i] = (a1x + a2x * P + pB1x[i] + pB2x[i] * Q) * 0.5f;
+        pPositionY[i] = (a1y + a2y * P + pB1y[i] + pB2y[i] * Q) * 0.5f;
+        pPositionZ[i] = (a1z + a2z * P + pB1z[i] + pB2z[i] * Q) * 0.5f;
+        pFirstDisplacement[i] = P;
+        pSecondDisplacement[i] = Q;
+        pIsValid[i] = static_cast<unsigned char>((pFirstCluster != pSecondClusters[i]) && !(1.f - std::fabs(cosTheta) < std::numeric_limits<float>::epsilon()));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPointingClusterHelper::GetAverageDirection(const LArPointingCluster::Vertex &firstVertex,
+    const LArPointingClusterArrays::VertexArrays &secondVertices, LArPointingClusterArrays::DirectionArrays &directionArrays)
+{
+    const std::size_t nVertices(secondVertices.m_directionX.size());
+    directionArrays.m_directionX.resize(nVertices);
+    directionArrays.m_directionY.resize(nVertices);
+    directionArrays.m_directionZ.resize(nVertices);
+    directionArrays.m_isValid.resize(nVertices);
+
+    const Cluster *const pFirstCluster(firstVertex.GetCluster());
+    const float energy1(pFirstCluster->GetHadronicEnergy());
+    const bool isFirstEnergyValid(!(energy1 < std::numeric_limits<float>::epsilon()));
+    const float d1x(firstVertex.GetDirection().GetX()), d1y(firstVertex.GetDirection().GetY()), d1z(firstVertex.GetDirection().GetZ());
+
+    const Cluster *const *const pSecondClusters(secondVertices.m_clusters.data());
+    const float *const pEnergy2(secondVertices.m_hadronicEnergy.data());
+    const float *const pD2x(secondVertices.m_directionX.data());
+    const float *const pD2y(secondVertices.m_directionY.data());
+    const float *const pD2z(secondVertices.m_directionZ.data());
+
+    float *const pDirectionX(directionArrays.m_directionX.data());
+    float *const pDirectionY(directionArrays.m_directionY.data());
+    float *const pDirectionZ(directionArrays.m_directionZ.data());
+    unsigned char *const pIsValid(directionArrays.m_isValid.data());
+
+    for (std::size_t i = 0; i < nVertices; ++i)
+    {
+        const float x(d1x * energy1 + pD2x[i] * pEnergy2[i]);
+        const float y(d1y * energy1 + pD2y[i] * pEnergy2[i]);
+        const float z(d1z * energy1 + pD2z[i] * pEnergy2[i]);
+        const float magnitude(std::sqrt(x * x + y * y + z * z));
+
+        pDirectionX[i] = x / magnitude;
+        pDirectionY[i] = y / magnitude;
+        pDirectionZ[i] = z / magnitude;
+        pIsValid[i] = static_cast<unsigned char>(isFirstEnergyValid && (pFirstCluster != pSecondClusters[i]) &&
+            !(pEnergy2[i] < std::numeric_limits<float>::epsilon()) && !(magnitude < std::numeric_limits<float>::epsilon()));
+    }
+}
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -11,6 +11,7 @@
 #include "Objects/Cluster.h"
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
+#include "larpandoracontent/LArObjects/LArPointingClusterArrays.h"
 
 namespace lar_content
 {
@@ -221,6 +222,67 @@ public:
     static void GetIntersection(const LArPointingCluster::Vertex &vertexCluster, const pandora::Cluster *const pTargetCluster,
         pandora::CartesianVector &intersectPosition, float &displacementL, float &displacementT);
 
+    /**
+     *  @brief  Calculate impact parameters between each of a set of pointing vertices and a target position, batched form of GetImpactParameters
+     *
+     *  @param  pointingVertices the pointing vertices
+     *  @param  targetPosition the target position
+     *  @param  longitudinal to receive the longitudinal displacements
+     *  @param  transverse to receive the transverse displacements
+     */
+    static void GetImpactParameters(const LArPointingClusterArrays::VertexArrays &pointingVertices, const pandora::CartesianVector &targetPosition,
+        pandora::FloatVector &longitudinal, pandora::FloatVector &transverse);
+
+    /**
+     *  @brief  Batched form of IsNode, using the impact parameters of a set of daughter vertices with respect to the parent vertex. Flags are
+     *          set for the daughter vertices that are nodes and left unchanged for the others, so that several tests can share a flag vector.
+     *
+     *  @param  longitudinal the longitudinal displacements
+     *  @param  transverse the transverse displacements
+     *  @param  minLongitudinalDistance the min longitudinal distance cut
+     *  @param  maxTransverseDistance the max transverse distance cut
+     *  @param  isNode the flags, one per daughter vertex
+     */
+    static void IsNode(const pandora::FloatVector &longitudinal, const pandora::FloatVector &transverse, const float minLongitudinalDistance,
+        const float maxTransverseDistance, LArPointingClusterArrays::FlagVector &isNode);
+
+    /**
+     *  @brief  Batched form of IsEmission, using the impact parameters of a set of daughter vertices with respect to the parent vertex. Flags
+     *          are set for the daughter vertices that are emitted and left unchanged for the others, so that several tests can share a flag vector.
+     *
+     *  @param  longitudinal the longitudinal displacements
+     *  @param  transverse the transverse displacements
+     *  @param  minLongitudinalDistance the min longitudinal distance cut
+     *  @param  maxLongitudinalDistance the max longitudinal distance cut
+     *  @param  maxTransverseDistance the max transverse distance cut
+     *  @param  angularAllowance the pointing angular allowance in degrees
+     *  @param  isEmission the flags, one per daughter vertex
+     */
+    static void IsEmission(const pandora::FloatVector &longitudinal, const pandora::FloatVector &transverse, const float minLongitudinalDistance,
+        const float maxLongitudinalDistance, const float maxTransverseDistance, const float angularAllowance, LArPointingClusterArrays::FlagVector &isEmission);
+
+    /**
+     *  @brief  Get intersection of a vertex with each of a set of vertices, batched form of GetIntersection. Intersections for which the
+     *          scalar function would throw, i.e. for vertices from the same cluster or for parallel vertices, are flagged as invalid.
+     *
+     *  @param  firstVertex the first vertex
+     *  @param  secondVertices the second vertices
+     *  @param  intersectionArrays to receive the intersections
+     */
+    static void GetIntersection(const LArPointingCluster::Vertex &firstVertex, const LArPointingClusterArrays::VertexArrays &secondVertices,
+        LArPointingClusterArrays::IntersectionArrays &intersectionArrays);
+
+    /**
+     *  @brief  Get average direction of a vertex with each of a set of vertices, batched form of GetAverageDirection. Directions for which
+     *          the scalar function would throw are flagged as invalid.
+     *
+     *  @param  firstVertex the first vertex
+     *  @param  secondVertices the second vertices
+     *  @param  directionArrays to receive the average directions
+     */
+    static void GetAverageDirection(const LArPointingCluster::Vertex &firstVertex, const LArPointingClusterArrays::VertexArrays &secondVertices,
+        LArPointingClusterArrays::DirectionArrays &directionArrays);
+
     /**
      *  @brief  Simple and fast vertex selection, choosing best vertex from a specified list to represent a set of pointing clusters
      *
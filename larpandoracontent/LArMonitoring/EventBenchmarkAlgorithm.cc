@@ -0,0 +1,481 @@
+/**
+ *  @file   larpandoracontent/LArMonitoring/EventBenchmarkAlgorithm.cc
+ *
+ *  @brief  Implementation of the event benchmark algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArMonitoring/EventBenchmarkAlgorithm.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+EventBenchmarkAlgorithm::EventBenchmarkAlgorithm() :
+    m_significanceThreshold(3.f),
+    m_minSlowdownFraction(0.02f)
+{
+}
+
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventBenchmarkAlgorithm::Initialize()
+{
+    m_outputFile.open(m_outputFileName, std::ios_base::out | std::ios_base::trunc);
+
+    if (!m_outputFile.is_open())
+    {
+        std::cout << "EventBenchmarkAlgorithm: could not open output file " << m_outputFileName << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    m_outputFile << std::fixed << std::setprecision(3);
+
+    if (!m_referenceFileName.empty() && (STATUS_CODE_SUCCESS != EventBenchmarkAlgorithm::ReadEventRecords(m_referenceFileName, m_referenceRecordVector)))
+    {
+        std::cout << "EventBenchmarkAlgorithm: could not read reference file " << m_referenceFileName << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventBenchmarkAlgorithm::Run()
+{
+    EventRecord eventRecord;
+    eventRecord.m_algorithmTimes.reserve(m_algorithmNames.size());
+
+    const std::chrono::steady_clock::time_point eventStart(std::chrono::steady_clock::now());
+
+    for (const std::string &algorithmName : m_algorithmNames)
+    {
+        const std::chrono::steady_clock::time_point algorithmStart(std::chrono::steady_clock::now());
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunDaughterAlgorithm(*this, algorithmName));
+        const std::chrono::steady_clock::time_point algorithmEnd(std::chrono::steady_clock::now());
+        eventRecord.m_algorithmTimes.push_back(std::chrono::duration<double, std::micro>(algorithmEnd - algorithmStart).count());
+    }
+
+    eventRecord.m_eventTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - eventStart).count();
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetOutputChecksum(eventRecord.m_checksum));
+
+    this->WriteEventRecord(m_eventRecordVector.size(), eventRecord);
+    m_eventRecordVector.push_back(eventRecord);
+
+    return this->WriteSummary();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventBenchmarkAlgorithm::GetOutputChecksum(std::uint64_t &checksum) const
+{
+    std::vector<const PfoList*> pfoListVector;
+
+    if (m_pfoListNames.empty())
+    {
+        const PfoList *pPfoList(nullptr);
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=,
+            PandoraContentApi::GetCurrentList(*this, pPfoList));
+        pfoListVector.push_back(pPfoList);
+    }
+
+    for (const std::string &pfoListName : m_pfoListNames)
+    {
+        const PfoList *pPfoList(nullptr);
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=,
+            PandoraContentApi::GetList(*this, pfoListName, pPfoList));
+        pfoListVector.push_back(pPfoList);
+    }
+
+    checksum = 0;
+
+    for (const PfoList *const pPfoList : pfoListVector)
+    {
+        std::uint64_t listChecksum(0);
+
+        if (pPfoList)
+        {
+            for (const ParticleFlowObject *const pPfo : *pPfoList)
+                listChecksum += EventBenchmarkAlgorithm::GetPfoChecksum(pPfo);
+        }
+
+        checksum = EventBenchmarkAlgorithm::Combine(checksum, pPfoList ? pPfoList->size() : 0);
+        checksum = EventBenchmarkAlgorithm::Combine(checksum, listChecksum);
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::uint64_t EventBenchmarkAlgorithm::GetPfoChecksum(const ParticleFlowObject *const pPfo)
+{
+    const std::uint64_t particleId(static_cast<std::uint64_t>(static_cast<std::int64_t>(pPfo->GetParticleId())));
+    std::uint64_t checksum(EventBenchmarkAlgorithm::Combine(0, particleId));
+    checksum = EventBenchmarkAlgorithm::Combine(checksum, pPfo->GetParentPfoList().size());
+    checksum = EventBenchmarkAlgorithm::Combine(checksum, pPfo->GetDaughterPfoList().size());
+
+    std::uint64_t clusterChecksum(0);
+
+    for (const Cluster *const pCluster : pPfo->GetClusterList())
+        clusterChecksum += EventBenchmarkAlgorithm::GetClusterChecksum(pCluster);
+
+    checksum = EventBenchmarkAlgorithm::Combine(checksum, pPfo->GetClusterList().size());
+    checksum = EventBenchmarkAlgorithm::Combine(checksum, clusterChecksum);
+
+    std::uint64_t vertexChecksum(0);
+
+    for (const Vertex *const pVertex : pPfo->GetVertexList())
+    {
+        const CartesianVector &position(pVertex->GetPosition());
+        vertexChecksum += EventBenchmarkAlgorithm::Combine(EventBenchmarkAlgorithm::Combine(EventBenchmarkAlgorithm::Combine(0,
+            EventBenchmarkAlgorithm::GetBits(position.GetX())), EventBenchmarkAlgorithm::GetBits(position.GetY())),
+            EventBenchmarkAlgorithm::GetBits(position.GetZ()));
+    }
+
+    checksum = EventBenchmarkAlgorithm::Combine(checksum, pPfo->GetVertexList().size());
+    return EventBenchmarkAlgorithm::Combine(checksum, vertexChecksum);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::uint64_t EventBenchmarkAlgorithm::GetClusterChecksum(const Cluster *const pCluster)
+{
+    std::uint64_t caloHitChecksum(0);
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+            caloHitChecksum += EventBenchmarkAlgorithm::GetCaloHitChecksum(pCaloHit);
+    }
+
+    std::uint64_t isolatedCaloHitChecksum(0);
+
+    for (const CaloHit *const pCaloHit : pCluster->GetIsolatedCaloHitList())
+        isolatedCaloHitChecksum += EventBenchmarkAlgorithm::GetCaloHitChecksum(pCaloHit);
+
+    std::uint64_t checksum(EventBenchmarkAlgorithm::Combine(0, pCluster->GetNCaloHits()));
+    checksum = EventBenchmarkAlgorithm::Combine(checksum, caloHitChecksum);
+    checksum = EventBenchmarkAlgorithm::Combine(checksum, pCluster->GetNIsolatedCaloHits());
+    return EventBenchmarkAlgorithm::Combine(checksum, isolatedCaloHitChecksum);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::uint64_t EventBenchmarkAlgorithm::GetCaloHitChecksum(const CaloHit *const pCaloHit)
+{
+    const CartesianVector &position(pCaloHit->GetPositionVector());
+
+    std::uint64_t checksum(EventBenchmarkAlgorithm::Combine(0, static_cast<std::uint64_t>(pCaloHit->GetHitType())));
+    checksum = EventBenchmarkAlgorithm::Combine(checksum, EventBenchmarkAlgorithm::GetBits(position.GetX()));
+    checksum = EventBenchmarkAlgorithm::Combine(checksum, EventBenchmarkAlgorithm::GetBits(position.GetY()));
+    checksum = EventBenchmarkAlgorithm::Combine(checksum, EventBenchmarkAlgorithm::GetBits(position.GetZ()));
+    return EventBenchmarkAlgorithm::Combine(checksum, EventBenchmarkAlgorithm::GetBits(pCaloHit->GetInputEnergy()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::uint64_t EventBenchmarkAlgorithm::Combine(const std::uint64_t checksum, const std::uint64_t value)
+{
+    // ATTN Mixing step of splitmix64, so that the sums of element checksums used for unordered collections are well distributed
+    std::uint64_t z(checksum ^ (value + 0x9e3779b97f4a7c15ULL + (checksum << 6) + (checksum >> 2)));
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return (z ^ (z >> 31));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::uint64_t EventBenchmarkAlgorithm::GetBits(const float value)
+{
+    std::uint32_t bits(0);
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventBenchmarkAlgorithm::WriteEventRecord(const unsigned int eventNumber, const EventRecord &eventRecord)
+{
+    char checksumString[17];
+    std::snprintf(checksumString, sizeof(checksumString), "%016llx", static_cast<unsigned long long>(eventRecord.m_checksum));
+
+    m_outputFile << "{\"event\":" << eventNumber << ",\"time_us\":" << eventRecord.m_eventTime << ",\"checksum\":\"" << checksumString
+                 << "\",\"algorithms\":{";
+
+    for (unsigned int iAlgorithm = 0; iAlgorithm < m_algorithmNames.size(); ++iAlgorithm)
+    {
+        m_outputFile << ((iAlgorithm > 0) ? "," : "") << EventBenchmarkAlgorithm::GetJsonString(m_algorithmNames.at(iAlgorithm)) << ":"
+                     << eventRecord.m_algorithmTimes.at(iAlgorithm);
+    }
+
+    m_outputFile << "}}" << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventBenchmarkAlgorithm::WriteSummary() const
+{
+    std::ofstream summaryFile(m_summaryFileName, std::ios_base::out | std::ios_base::trunc);
+
+    if (!summaryFile.is_open())
+    {
+        std::cout << "EventBenchmarkAlgorithm: could not open summary file " << m_summaryFileName << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    summaryFile << std::fixed << std::setprecision(3);
+
+    TimeVector sortedTimes;
+    EventBenchmarkAlgorithm::GetSortedEventTimes(m_eventRecordVector, sortedTimes);
+
+    double totalTime(0.);
+
+    for (const double time : sortedTimes)
+        totalTime += time;
+
+    const double meanTime(sortedTimes.empty() ? 0. : totalTime / sortedTimes.size());
+    const double eventsPerSecond((totalTime > 0.) ? 1.e6 * sortedTimes.size() / totalTime : 0.);
+
+    summaryFile << "{\"summary\":{\"events\":" << sortedTimes.size() << ",\"mean_us\":" << meanTime
+                << ",\"p50_us\":" << EventBenchmarkAlgorithm::GetPercentile(sortedTimes, 0.5f)
+                << ",\"p90_us\":" << EventBenchmarkAlgorithm::GetPercentile(sortedTimes, 0.9f)
+                << ",\"p99_us\":" << EventBenchmarkAlgorithm::GetPercentile(sortedTimes, 0.99f)
+                << ",\"max_us\":" << (sortedTimes.empty() ? 0. : sortedTimes.back())
+                << ",\"events_per_second\":" << eventsPerSecond << "}}" << std::endl;
+
+    if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+    {
+        std::cout << "EventBenchmarkAlgorithm: " << sortedTimes.size() << " events, mean " << meanTime << " us, median "
+                  << EventBenchmarkAlgorithm::GetPercentile(sortedTimes, 0.5f) << " us, " << eventsPerSecond << " events per second"
+                  << std::endl;
+    }
+
+    if (!m_referenceFileName.empty())
+        this->WriteComparison(summaryFile);
+
+    return (summaryFile.good() ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventBenchmarkAlgorithm::WriteComparison(std::ofstream &summaryFile) const
+{
+    // ATTN The events are paired by index, so only the events processed so far in this run are compared
+    const std::size_t nCompared(std::min(m_eventRecordVector.size(), m_referenceRecordVector.size()));
+    std::vector<std::size_t> mismatchedEvents;
+    TimeVector times, referenceTimes;
+
+    for (std::size_t iEvent = 0; iEvent < nCompared; ++iEvent)
+    {
+        const EventRecord &eventRecord(m_eventRecordVector.at(iEvent)), &referenceRecord(m_referenceRecordVector.at(iEvent));
+
+        if (eventRecord.m_checksum != referenceRecord.m_checksum)
+            mismatchedEvents.push_back(iEvent);
+
+        times.push_back(eventRecord.m_eventTime);
+        referenceTimes.push_back(referenceRecord.m_eventTime);
+    }
+
+    const double zScore(EventBenchmarkAlgorithm::GetSignedRankZScore(times, referenceTimes));
+
+    std::sort(times.begin(), times.end());
+    std::sort(referenceTimes.begin(), referenceTimes.end());
+
+    const double referenceMedian(EventBenchmarkAlgorithm::GetPercentile(referenceTimes, 0.5f));
+    const double median(EventBenchmarkAlgorithm::GetPercentile(times, 0.5f));
+    const double medianRatio((referenceMedian > 0.) ? median / referenceMedian : 0.);
+    const bool isSlowdown((zScore > m_significanceThreshold) && (medianRatio > 1. + m_minSlowdownFraction));
+
+    summaryFile << "{\"comparison\":{\"reference\":" << EventBenchmarkAlgorithm::GetJsonString(m_referenceFileName)
+                << ",\"events\":" << m_eventRecordVector.size() << ",\"reference_events\":" << m_referenceRecordVector.size()
+                << ",\"compared_events\":" << nCompared << ",\"checksum_mismatches\":" << mismatchedEvents.size() << ",\"mismatched_events\":[";
+
+    for (std::size_t iMismatch = 0; iMismatch < mismatchedEvents.size(); ++iMismatch)
+        summaryFile << ((iMismatch > 0) ? "," : "") << mismatchedEvents.at(iMismatch);
+
+    summaryFile << "],\"median_ratio\":" << medianRatio << ",\"z_score\":" << zScore << ",\"significant_slowdown\":"
+                << (isSlowdown ? "true" : "false") << "}}" << std::endl;
+
+    if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+    {
+        std::cout << "EventBenchmarkAlgorithm: comparison with " << m_referenceFileName << ", " << mismatchedEvents.size() << " of "
+                  << nCompared << " events with different output, median time ratio " << medianRatio << ", z score " << zScore
+                  << (isSlowdown ? ", SIGNIFICANT SLOWDOWN" : "") << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventBenchmarkAlgorithm::ReadEventRecords(const std::string &fileName, EventRecordVector &eventRecordVector)
+{
+    std::ifstream inputFile(fileName);
+
+    if (!inputFile.is_open())
+        return STATUS_CODE_NOT_FOUND;
+
+    const std::string eventKey("{\"event\":"), timeKey("\"time_us\":"), checksumKey("\"checksum\":\"");
+    std::string line;
+
+    while (std::getline(inputFile, line))
+    {
+        if (0 != line.compare(0, eventKey.size(), eventKey))
+            continue;
+
+        const std::size_t timePosition(line.find(timeKey)), checksumPosition(line.find(checksumKey));
+
+        if ((std::string::npos == timePosition) || (std::string::npos == checksumPosition))
+            return STATUS_CODE_FAILURE;
+
+        EventRecord eventRecord;
+        eventRecord.m_eventTime = std::strtod(line.c_str() + timePosition + timeKey.size(), nullptr);
+        eventRecord.m_checksum = std::strtoull(line.c_str() + checksumPosition + checksumKey.size(), nullptr, 16);
+        eventRecordVector.push_back(eventRecord);
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventBenchmarkAlgorithm::GetSortedEventTimes(const EventRecordVector &eventRecordVector, TimeVector &timeVector)
+{
+    timeVector.reserve(eventRecordVector.size());
+
+    for (const EventRecord &eventRecord : eventRecordVector)
+        timeVector.push_back(eventRecord.m_eventTime);
+
+    std::sort(timeVector.begin(), timeVector.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double EventBenchmarkAlgorithm::GetPercentile(const TimeVector &sortedTimes, const float fraction)
+{
+    if (sortedTimes.empty())
+        return 0.;
+
+    const std::size_t rank(static_cast<std::size_t>(std::ceil(fraction * sortedTimes.size())));
+    return sortedTimes.at(std::min(std::max<std::size_t>(rank, 1), sortedTimes.size()) - 1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double EventBenchmarkAlgorithm::GetSignedRankZScore(const TimeVector &times, const TimeVector &referenceTimes)
+{
+    if (times.size() != referenceTimes.size())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    // Discard pairs with no difference and order the remaining differences by magnitude
+    TimeVector differences;
+
+    for (std::size_t iTime = 0; iTime < times.size(); ++iTime)
+    {
+        const double difference(times.at(iTime) - referenceTimes.at(iTime));
+
+        if (std::fabs(difference) > 0.)
+            differences.push_back(difference);
+    }
+
+    if (differences.empty())
+        return 0.;
+
+    std::sort(differences.begin(), differences.end(), [](const double lhs, const double rhs) { return (std::fabs(lhs) < std::fabs(rhs)); });
+
+    // Sum the ranks of the positive differences, giving tied magnitudes their average rank
+    const std::size_t nDifferences(differences.size());
+    double positiveRankSum(0.), tieSum(0.);
+
+    for (std::size_t iFirst = 0; iFirst < nDifferences; )
+    {
+        std::size_t iLast(iFirst + 1);
+
+        while ((iLast < nDifferences) && (std::fabs(differences.at(iLast)) == std::fabs(differences.at(iFirst))))
+            ++iLast;
+
+        const double nTied(iLast - iFirst), averageRank(0.5 * (iFirst + 1 + iLast));
+
+        for (std::size_t iTied = iFirst; iTied < iLast; ++iTied)
+        {
+            if (differences.at(iTied) > 0.)
+                positiveRankSum += averageRank;
+        }
+
+        tieSum += nTied * nTied * nTied - nTied;
+        iFirst = iLast;
+    }
+
+    const double n(nDifferences);
+    const double variance(n * (n + 1.) * (2. * n + 1.) / 24. - tieSum / 48.);
+
+    return ((variance > 0.) ? (positiveRankSum - 0.25 * n * (n + 1.)) / std::sqrt(variance) : 0.);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::string EventBenchmarkAlgorithm::GetJsonString(const std::string &input)
+{
+    std::string output("\"");
+
+    for (const char character : input)
+    {
+        if (('"' == character) || ('\\' == character))
+            output.push_back('\\');
+
+        output.push_back(character);
+    }
+
+    output.push_back('"');
+    return output;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventBenchmarkAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithmList(*this, xmlHandle, "Algorithms", m_algorithmNames));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadVectorOfValues(xmlHandle,
+        "PfoListNames", m_pfoListNames));
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle,
+        "OutputFileName", m_outputFileName));
+
+    m_summaryFileName = m_outputFileName + ".summary";
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "SummaryFileName", m_summaryFileName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ReferenceFileName", m_referenceFileName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "SignificanceThreshold", m_significanceThreshold));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "MinSlowdownFraction", m_minSlowdownFraction));
+
+    if ((m_outputFileName == m_referenceFileName) || (m_summaryFileName == m_referenceFileName) || (m_summaryFileName == m_outputFileName))
+    {
+        std::cout << "EventBenchmarkAlgorithm: OutputFileName, SummaryFileName and ReferenceFileName must differ" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
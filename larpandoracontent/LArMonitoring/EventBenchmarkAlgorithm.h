@@ -0,0 +1,197 @@
+/**
+ *  @file   larpandoracontent/LArMonitoring/EventBenchmarkAlgorithm.h
+ *
+ *  @brief  Header file for the event benchmark algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_EVENT_BENCHMARK_ALGORITHM_H
+#define LAR_EVENT_BENCHMARK_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+#include <cstdint>
+#include <fstream>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  EventBenchmarkAlgorithm class, running a list of daughter algorithms for each event and recording their wall-clock time and a
+ *          checksum of the output pfos. Events can be replayed by an event reading algorithm placed before this algorithm.
+ *
+ *          One json record is written to the output file for each event. After each event, the summary file is rewritten with the
+ *          event time percentiles so far, so that it is complete whenever the run ends. If a reference output file from an earlier
+ *          run over the same events is provided, the summary file also holds a comparison with that run: the checksums of the events
+ *          processed so far are compared and the event times are tested for a significant slowdown, using a one-sided Wilcoxon signed
+ *          rank test on the per-event time differences.
+ */
+class EventBenchmarkAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    EventBenchmarkAlgorithm();
+
+private:
+    /**
+     *  @brief  EventRecord class
+     */
+    class EventRecord
+    {
+    public:
+        double                  m_eventTime;            ///< The wall-clock time to run the daughter algorithms, units us
+        std::vector<double>     m_algorithmTimes;       ///< The wall-clock time to run each daughter algorithm, units us
+        std::uint64_t           m_checksum;             ///< The checksum of the output pfos
+    };
+
+    typedef std::vector<EventRecord> EventRecordVector;
+    typedef std::vector<double> TimeVector;
+
+    pandora::StatusCode Initialize();
+    pandora::StatusCode Run();
+
+    /**
+     *  @brief  Get the checksum of the pfos in the named output lists. The checksum depends only on the pfo properties, hits and vertices,
+     *          not on the order of pfos in a list or on object addresses.
+     *
+     *  @param  checksum to receive the checksum
+     *
+     *  @return success
+     */
+    pandora::StatusCode GetOutputChecksum(std::uint64_t &checksum) const;
+
+    /**
+     *  @brief  Get the checksum of a pfo
+     *
+     *  @param  pPfo address of the pfo
+     *
+     *  @return the checksum
+     */
+    static std::uint64_t GetPfoChecksum(const pandora::ParticleFlowObject *const pPfo);
+
+    /**
+     *  @brief  Get the checksum of a cluster
+     *
+     *  @param  pCluster address of the cluster
+     *
+     *  @return the checksum
+     */
+    static std::uint64_t GetClusterChecksum(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Get the checksum of a calo hit
+     *
+     *  @param  pCaloHit address of the calo hit
+     *
+     *  @return the checksum
+     */
+    static std::uint64_t GetCaloHitChecksum(const pandora::CaloHit *const pCaloHit);
+
+    /**
+     *  @brief  Combine a value into a checksum, with a dependence on order
+     *
+     *  @param  checksum the checksum
+     *  @param  value the value
+     *
+     *  @return the combined checksum
+     */
+    static std::uint64_t Combine(const std::uint64_t checksum, const std::uint64_t value);
+
+    /**
+     *  @brief  Get the bit pattern of a float, for use in a checksum
+     *
+     *  @param  value the float
+     *
+     *  @return the bit pattern
+     */
+    static std::uint64_t GetBits(const float value);
+
+    /**
+     *  @brief  Write the record for an event to the output file
+     *
+     *  @param  eventNumber the event number
+     *  @param  eventRecord the event record
+     */
+    void WriteEventRecord(const unsigned int eventNumber, const EventRecord &eventRecord);
+
+    /**
+     *  @brief  Rewrite the summary file, with the summary of the event times so far and any comparison with the reference run
+     *
+     *  @return success
+     */
+    pandora::StatusCode WriteSummary() const;
+
+    /**
+     *  @brief  Compare the event checksums and times so far with those of the same events in the reference run
+     *
+     *  @param  summaryFile the summary file, to receive the result
+     */
+    void WriteComparison(std::ofstream &summaryFile) const;
+
+    /**
+     *  @brief  Read the event records from an output file written by an earlier run
+     *
+     *  @param  fileName the file name
+     *  @param  eventRecordVector to receive the event records, excluding the daughter algorithm times
+     *
+     *  @return success
+     */
+    static pandora::StatusCode ReadEventRecords(const std::string &fileName, EventRecordVector &eventRecordVector);
+
+    /**
+     *  @brief  Get the event times from a vector of event records, sorted in increasing order
+     *
+     *  @param  eventRecordVector the event records
+     *  @param  timeVector to receive the sorted event times
+     */
+    static void GetSortedEventTimes(const EventRecordVector &eventRecordVector, TimeVector &timeVector);
+
+    /**
+     *  @brief  Get a percentile of a sorted vector of times, using the nearest rank
+     *
+     *  @param  sortedTimes the sorted times
+     *  @param  fraction the percentile, as a fraction
+     *
+     *  @return the percentile
+     */
+    static double GetPercentile(const TimeVector &sortedTimes, const float fraction);
+
+    /**
+     *  @brief  Get the z score of the Wilcoxon signed rank test that event times are larger than the reference times for the same events
+     *
+     *  @param  times the event times
+     *  @param  referenceTimes the reference event times, paired with the event times by index
+     *
+     *  @return the z score, in the normal approximation with zero differences discarded and a correction for ties
+     */
+    static double GetSignedRankZScore(const TimeVector &times, const TimeVector &referenceTimes);
+
+    /**
+     *  @brief  Get a string in a form suitable for a json file
+     *
+     *  @param  input the input string
+     *
+     *  @return the quoted and escaped string
+     */
+    static std::string GetJsonString(const std::string &input);
+
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    pandora::StringVector   m_algorithmNames;           ///< The names of the daughter algorithms to run
+    pandora::StringVector   m_pfoListNames;             ///< The names of the pfo lists to checksum, the current list if none specified
+    std::string             m_outputFileName;           ///< The name of the output file
+    std::string             m_summaryFileName;          ///< The name of the summary file, by default the output file name with ".summary"
+    std::string             m_referenceFileName;        ///< The name of the output file of a reference run, if a comparison is required
+    float                   m_significanceThreshold;    ///< The minimum signed rank z score to flag a slowdown
+    float                   m_minSlowdownFraction;      ///< The minimum fractional increase in median event time to flag a slowdown
+    std::ofstream           m_outputFile;               ///< The output file
+    EventRecordVector       m_eventRecordVector;        ///< The event records for this run
+    EventRecordVector       m_referenceRecordVector;    ///< The event records for the reference run
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_EVENT_BENCHMARK_ALGORITHM_H
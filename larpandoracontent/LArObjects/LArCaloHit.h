@@ -18,6 +18,8 @@
 #include "Persistency/XmlFileReader.h"
 #include "Persistency/XmlFileWriter.h"
 
+#include "larpandoracontent/LArObjects/LArObjectPool.h"
+
 namespace lar_content
 {
 
@@ -46,6 +48,40 @@ public:
      */
     LArCaloHit(const LArCaloHitParameters &parameters);
 
+    /**
+     *  @brief  Allocate storage for a new object from the global operator new
+     *
+     *  @param  size the size of the object
+     *
+     *  @return the address of the storage
+     */
+    static void *operator new(std::size_t size);
+
+    /**
+     *  @brief  Allocate storage for a new object from a LArCaloHit pool
+     *
+     *  @param  size the size of the object
+     *  @param  objectPool the pool
+     *
+     *  @return the address of the storage
+     */
+    static void *operator new(std::size_t size, ObjectPool<LArCaloHit> &objectPool);
+
+    /**
+     *  @brief  Release the storage for a deleted object, returning it to its pool if it was allocated from one
+     *
+     *  @param  pAddress the address of the storage
+     */
+    static void operator delete(void *pAddress);
+
+    /**
+     *  @brief  Release the storage for an object whose construction from a LArCaloHit pool failed
+     *
+     *  @param  pAddress the address of the storage
+     *  @param  objectPool the pool
+     */
+    static void operator delete(void *pAddress, ObjectPool<LArCaloHit> &objectPool);
+
     /**
      *  @brief  Get the lar tpc volume id
      *
@@ -142,7 +178,8 @@ public:
     pandora::StatusCode Create(const Parameters &parameters, const Object *&pObject) const;
 
 private:
-    unsigned int            m_version;              ///< The LArCaloHit version
+    unsigned int                                m_version;          ///< The LArCaloHit version
+    ObjectPool<LArCaloHit>::ObjectPoolPtr       m_spObjectPool;     ///< The pool providing storage for the LArCaloHits created
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -157,6 +194,34 @@ inline LArCaloHit::LArCaloHit(const LArCaloHitParameters &parameters) :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline void *LArCaloHit::operator new(std::size_t size)
+{
+    return ObjectPool<LArCaloHit>::Allocate(nullptr, size);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void *LArCaloHit::operator new(std::size_t size, ObjectPool<LArCaloHit> &objectPool)
+{
+    return ObjectPool<LArCaloHit>::Allocate(&objectPool, size);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArCaloHit::operator delete(void *pAddress)
+{
+    ObjectPool<LArCaloHit>::Deallocate(pAddress);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArCaloHit::operator delete(void *pAddress, ObjectPool<LArCaloHit> &)
+{
+    ObjectPool<LArCaloHit>::Deallocate(pAddress);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline unsigned int LArCaloHit::GetLArTPCVolumeId() const
 {
     return m_larTPCVolumeId;
@@ -207,7 +272,8 @@ inline void LArCaloHit::SetShowerProbability(const float probability)
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline LArCaloHitFactory::LArCaloHitFactory(const unsigned int version) :
-    m_version(version)
+    m_version(version),
+    m_spObjectPool(ObjectPool<LArCaloHit>::Create())
 {
 }
 
@@ -223,7 +289,7 @@ inline LArCaloHitFactory::Parameters *LArCaloHitFactory::NewParameters() const
 inline pandora::StatusCode LArCaloHitFactory::Create(const Parameters &parameters, const Object *&pObject) const
 {
     const LArCaloHitParameters &larCaloHitParameters(dynamic_cast<const LArCaloHitParameters&>(parameters));
-    pObject = new LArCaloHit(larCaloHitParameters);
+    pObject = new (*m_spObjectPool) LArCaloHit(larCaloHitParameters);
 
     return pandora::STATUS_CODE_SUCCESS;
 }
@@ -18,6 +18,8 @@
 #include "Persistency/XmlFileReader.h"
 #include "Persistency/XmlFileWriter.h"
 
+#include "larpandoracontent/LArObjects/LArObjectPool.h"
+
 namespace lar_content
 {
 
@@ -45,6 +47,40 @@ public:
      */
     LArMCParticle(const LArMCParticleParameters &parameters);
 
+    /**
+     *  @brief  Allocate storage for a new object from the global operator new
+     *
+     *  @param  size the size of the object
+     *
+     *  @return the address of the storage
+     */
+    static void *operator new(std::size_t size);
+
+    /**
+     *  @brief  Allocate storage for a new object from a LArMCParticle pool
+     *
+     *  @param  size the size of the object
+     *  @param  objectPool the pool
+     *
+     *  @return the address of the storage
+     */
+    static void *operator new(std::size_t size, ObjectPool<LArMCParticle> &objectPool);
+
+    /**
+     *  @brief  Release the storage for a deleted object, returning it to its pool if it was allocated from one
+     *
+     *  @param  pAddress the address of the storage
+     */
+    static void operator delete(void *pAddress);
+
+    /**
+     *  @brief  Release the storage for an object whose construction from a LArMCParticle pool failed
+     *
+     *  @param  pAddress the address of the storage
+     *  @param  objectPool the pool
+     */
+    static void operator delete(void *pAddress, ObjectPool<LArMCParticle> &objectPool);
+
     /**
      *  @brief  Get the nuance code
      *
@@ -64,6 +100,11 @@ private:
 class LArMCParticleFactory : public pandora::ObjectFactory<object_creation::MCParticle::Parameters, object_creation::MCParticle::Object>
 {
 public:
+    /**
+     *  @brief  Default constructor
+     */
+    LArMCParticleFactory();
+
     /**
      *  @brief  Create new parameters instance on the heap (memory-management to be controlled by user)
      *
@@ -94,6 +135,9 @@ public:
      *  @param  pObject to receive the address of the object created
      */
     pandora::StatusCode Create(const Parameters &parameters, const Object *&pObject) const;
+
+private:
+    ObjectPool<LArMCParticle>::ObjectPoolPtr    m_spObjectPool;     ///< The pool providing storage for the LArMCParticles created
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -107,6 +151,34 @@ inline LArMCParticle::LArMCParticle(const LArMCParticleParameters &parameters) :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline void *LArMCParticle::operator new(std::size_t size)
+{
+    return ObjectPool<LArMCParticle>::Allocate(nullptr, size);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void *LArMCParticle::operator new(std::size_t size, ObjectPool<LArMCParticle> &objectPool)
+{
+    return ObjectPool<LArMCParticle>::Allocate(&objectPool, size);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArMCParticle::operator delete(void *pAddress)
+{
+    ObjectPool<LArMCParticle>::Deallocate(pAddress);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArMCParticle::operator delete(void *pAddress, ObjectPool<LArMCParticle> &)
+{
+    ObjectPool<LArMCParticle>::Deallocate(pAddress);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline int LArMCParticle::GetNuanceCode() const
 {
     return m_nuanceCode;
@@ -115,6 +187,13 @@ inline int LArMCParticle::GetNuanceCode() const
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline LArMCParticleFactory::LArMCParticleFactory() :
+    m_spObjectPool(ObjectPool<LArMCParticle>::Create())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline LArMCParticleFactory::Parameters *LArMCParticleFactory::NewParameters() const
 {
     return (new LArMCParticleParameters);
@@ -125,7 +204,7 @@ inline LArMCParticleFactory::Parameters *LArMCParticleFactory::NewParameters() c
 inline pandora::StatusCode LArMCParticleFactory::Create(const Parameters &parameters, const Object *&pObject) const
 {
     const LArMCParticleParameters &larMCParticleParameters(dynamic_cast<const LArMCParticleParameters&>(parameters));
-    pObject = new LArMCParticle(larMCParticleParameters);
+    pObject = new (*m_spObjectPool) LArMCParticle(larMCParticleParameters);
 
     return pandora::STATUS_CODE_SUCCESS;
 }
@@ -0,0 +1,214 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArObjectPool.h
+ *
+ *  @brief  Header file for the lar object pool class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_OBJECT_POOL_H
+#define LAR_OBJECT_POOL_H 1
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ObjectPool class, providing storage for objects of a single type in contiguous blocks, for use by class-specific operator new
+ *          and operator delete. Each pool is owned by an object factory, so pandora instances with their own factories never share a
+ *          pool. Objects are placed consecutively in creation order and storage released by individual deletions is not reused within
+ *          an event, so no two objects in an event share an address. Once every object has been deleted, i.e. when the pandora object
+ *          lists are reset at the end of an event, the pool is reset and the next objects are again placed from the start of the first
+ *          block. Blocks are retained until the owning factory and every object allocated from the pool have been deleted. Each
+ *          allocation is preceded by the address of its pool, or nullptr for storage taken from the global operator new (objects not
+ *          created via a factory, or of a different size, e.g. from a derived class), so that operator delete needs no other context.
+ */
+template <typename T>
+class ObjectPool
+{
+public:
+    typedef std::shared_ptr<ObjectPool> ObjectPoolPtr;
+
+    /**
+     *  @brief  Create a pool, to be held by an object factory. When the last copy of the returned pointer is released, the pool is
+     *          deleted once every object allocated from it has been deleted.
+     *
+     *  @return the shared pointer to the pool
+     */
+    static ObjectPoolPtr Create();
+
+    /**
+     *  @brief  Allocate storage for an object
+     *
+     *  @param  pPool the address of the pool, or nullptr to use the global operator new
+     *  @param  size the size of the object
+     *
+     *  @return the address of the storage
+     */
+    static void *Allocate(ObjectPool *const pPool, const std::size_t size);
+
+    /**
+     *  @brief  Release storage for an object, allocated via Allocate
+     *
+     *  @param  pAddress the address of the storage
+     */
+    static void Deallocate(void *const pAddress);
+
+private:
+    /**
+     *  @brief  Default constructor
+     */
+    ObjectPool();
+
+    /**
+     *  @brief  Take the storage for a new object from the current block
+     *
+     *  @return the address of the slot holding the storage
+     */
+    void *TakeSlot();
+
+    /**
+     *  @brief  Record the deletion of an object, resetting the pool if no objects remain, and deleting it if it is also orphaned
+     */
+    void ReleaseSlot();
+
+    /**
+     *  @brief  Record that the owning factory has released the pool, deleting it if no objects remain
+     *
+     *  @param  pPool the address of the pool
+     */
+    static void Orphan(ObjectPool *const pPool);
+
+    static_assert(alignof(T) <= alignof(std::max_align_t), "ObjectPool: over-aligned types are not supported");
+
+    static const std::size_t m_headerSize = ((sizeof(ObjectPool*) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t)) *
+        alignof(std::max_align_t);                          ///< The size of the header holding the pool address, preserving alignment
+    static const std::size_t m_nSlotsPerBlock = 4096;       ///< The number of objects per block
+
+    typedef typename std::aligned_storage<m_headerSize + sizeof(T), alignof(std::max_align_t)>::type Slot;
+    typedef std::vector<std::unique_ptr<Slot[]>> BlockVector;
+
+    std::mutex          m_mutex;                            ///< The mutex protecting this pool, only contended if its factory is shared
+    BlockVector         m_blockVector;                      ///< The blocks of storage
+    std::size_t         m_currentBlock;                     ///< The index of the block from which new storage is taken
+    std::size_t         m_currentSlot;                      ///< The index of the next unused slot in the current block
+    std::size_t         m_nLiveObjects;                     ///< The number of objects currently allocated from the pool
+    bool                m_isOrphaned;                       ///< Whether the owning factory has released the pool
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline typename ObjectPool<T>::ObjectPoolPtr ObjectPool<T>::Create()
+{
+    return ObjectPoolPtr(new ObjectPool, &ObjectPool::Orphan);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void *ObjectPool<T>::Allocate(ObjectPool *const pPool, const std::size_t size)
+{
+    const bool usePool(pPool && (sizeof(T) == size));
+    void *const pSlot(usePool ? pPool->TakeSlot() : ::operator new(m_headerSize + size));
+    *static_cast<ObjectPool**>(pSlot) = (usePool ? pPool : nullptr);
+
+    return (static_cast<char*>(pSlot) + m_headerSize);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void ObjectPool<T>::Deallocate(void *const pAddress)
+{
+    if (!pAddress)
+        return;
+
+    void *const pSlot(static_cast<char*>(pAddress) - m_headerSize);
+    ObjectPool *const pPool(*static_cast<ObjectPool**>(pSlot));
+
+    if (!pPool)
+    {
+        ::operator delete(pSlot);
+        return;
+    }
+
+    pPool->ReleaseSlot();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline ObjectPool<T>::ObjectPool() :
+    m_currentBlock(0),
+    m_currentSlot(0),
+    m_nLiveObjects(0),
+    m_isOrphaned(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void *ObjectPool<T>::TakeSlot()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_currentSlot == m_nSlotsPerBlock)
+    {
+        ++m_currentBlock;
+        m_currentSlot = 0;
+    }
+
+    if (m_currentBlock == m_blockVector.size())
+        m_blockVector.emplace_back(new Slot[m_nSlotsPerBlock]);
+
+    ++m_nLiveObjects;
+    return &(m_blockVector.at(m_currentBlock)[m_currentSlot++]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void ObjectPool<T>::ReleaseSlot()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (--m_nLiveObjects > 0)
+            return;
+
+        m_currentBlock = 0;
+        m_currentSlot = 0;
+
+        if (!m_isOrphaned)
+            return;
+    }
+
+    delete this;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void ObjectPool<T>::Orphan(ObjectPool *const pPool)
+{
+    {
+        std::lock_guard<std::mutex> lock(pPool->m_mutex);
+        pPool->m_isOrphaned = true;
+
+        if (pPool->m_nLiveObjects > 0)
+            return;
+    }
+
+    delete pPool;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_OBJECT_POOL_H
@@ -32,6 +32,9 @@ void OverlapTensor<T>::GetUnambiguousElements(const bool ignoreUnavailable, Elem
 {
     for (typename TheTensor::const_iterator iterU = this->begin(), iterUEnd = this->end(); iterU != iterUEnd; ++iterU)
     {
+        if (!this->IsAllowedKeyCluster(iterU->first))
+            continue;
+
         ElementList tempElementList;
         ClusterList clusterListU, clusterListV, clusterListW;
         this->GetConnectedElements(iterU->first, ignoreUnavailable, tempElementList, clusterListU, clusterListV, clusterListW);
@@ -95,7 +98,10 @@ template <typename T>
 void OverlapTensor<T>::GetSortedKeyClusters(ClusterVector &sortedKeyClusters) const
 {
     for (typename TheTensor::const_iterator iterU = this->begin(), iterUEnd = this->end(); iterU != iterUEnd; ++iterU)
-        sortedKeyClusters.push_back(iterU->first);
+    {
+        if (this->IsAllowedKeyCluster(iterU->first))
+            sortedKeyClusters.push_back(iterU->first);
+    }
 
     std::sort(sortedKeyClusters.begin(), sortedKeyClusters.end(), LArClusterHelper::SortByNHits);
 }
@@ -115,6 +121,11 @@ void OverlapTensor<T>::SetOverlapResult(const pandora::Cluster *const pClusterU,
     if (!overlapList.insert(typename OverlapList::value_type(pClusterW, overlapResult)).second)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
 
+    this->RemoveRestriction();
+    this->RecordChange(pClusterU);
+    this->RecordChange(pClusterV);
+    this->RecordChange(pClusterW);
+
     ClusterList &navigationUV(m_clusterNavigationMapUV[pClusterU]);
     ClusterList &navigationVW(m_clusterNavigationMapVW[pClusterV]);
     ClusterList &navigationWU(m_clusterNavigationMapWU[pClusterW]);
@@ -146,6 +157,11 @@ void OverlapTensor<T>::ReplaceOverlapResult(const pandora::Cluster *const pClust
         throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
 
     iterW->second = overlapResult;
+
+    this->RemoveRestriction();
+    this->RecordChange(pClusterU);
+    this->RecordChange(pClusterV);
+    this->RecordChange(pClusterW);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -153,6 +169,13 @@ void OverlapTensor<T>::ReplaceOverlapResult(const pandora::Cluster *const pClust
 template <typename T>
 void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
 {
+    this->RemoveRestriction();
+    this->RecordConnectedChanges(pCluster);
+
+    // ATTN The cluster may be deleted once removed from the tensor, so its address is not kept; the changes recorded for the clusters
+    // sharing elements with it mark the affected region
+    m_lastChangeMap.erase(pCluster);
+
     ClusterList additionalRemovals;
 
     if (m_clusterNavigationMapUV.erase(pCluster) > 0)
@@ -232,6 +255,122 @@ void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void OverlapTensor<T>::RestrictToChangesSince(const std::size_t changeMarker)
+{
+    this->RemoveRestriction();
+    m_isRestricted = true;
+
+    ClusterSet exploredClusters;
+
+    for (const ClusterToChangeMap::value_type &mapEntry : m_lastChangeMap)
+    {
+        if (mapEntry.second < changeMarker)
+            continue;
+
+        const Cluster *const pChangedCluster(mapEntry.first);
+
+        // ATTN Only explore from changed clusters still present in the tensor, e.g. not those recorded only via an availability change
+        if (!exploredClusters.insert(pChangedCluster).second || (!m_clusterNavigationMapUV.count(pChangedCluster) &&
+            !m_clusterNavigationMapVW.count(pChangedCluster) && !m_clusterNavigationMapWU.count(pChangedCluster)))
+        {
+            continue;
+        }
+
+        ClusterList clusterListU, clusterListV, clusterListW;
+        this->ExploreConnections(pChangedCluster, false, clusterListU, clusterListV, clusterListW);
+        m_allowedKeyClusters.insert(clusterListU.begin(), clusterListU.end());
+        exploredClusters.insert(clusterListV.begin(), clusterListV.end());
+        exploredClusters.insert(clusterListW.begin(), clusterListW.end());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapTensor<T>::RecordConnectedChanges(const Cluster *const pCluster)
+{
+    if (!m_recordChanges)
+        return;
+
+    this->RecordChange(pCluster);
+
+    // ATTN Use the navigation maps to visit only the elements containing the cluster, whether it is the u, v or w cluster
+    typename TheTensor::const_iterator iterU(m_overlapTensor.find(pCluster));
+
+    if (m_overlapTensor.end() != iterU)
+    {
+        for (const typename OverlapMatrix::value_type &matrixEntry : iterU->second)
+        {
+            this->RecordChange(matrixEntry.first);
+
+            for (const typename OverlapList::value_type &listEntry : matrixEntry.second)
+                this->RecordChange(listEntry.first);
+        }
+    }
+
+    typename ClusterNavigationMap::const_iterator iterVW(m_clusterNavigationMapVW.find(pCluster));
+
+    if (m_clusterNavigationMapVW.end() != iterVW)
+    {
+        for (const Cluster *const pClusterW : iterVW->second)
+        {
+            typename ClusterNavigationMap::const_iterator iterWU(m_clusterNavigationMapWU.find(pClusterW));
+
+            if (m_clusterNavigationMapWU.end() == iterWU)
+                continue;
+
+            for (const Cluster *const pClusterU : iterWU->second)
+            {
+                if (this->HasElement(pClusterU, pCluster, pClusterW))
+                {
+                    this->RecordChange(pClusterU);
+                    this->RecordChange(pClusterW);
+                }
+            }
+        }
+    }
+
+    typename ClusterNavigationMap::const_iterator iterWU(m_clusterNavigationMapWU.find(pCluster));
+
+    if (m_clusterNavigationMapWU.end() != iterWU)
+    {
+        for (const Cluster *const pClusterU : iterWU->second)
+        {
+            typename TheTensor::const_iterator iterUV(m_overlapTensor.find(pClusterU));
+
+            if (m_overlapTensor.end() == iterUV)
+                continue;
+
+            for (const typename OverlapMatrix::value_type &matrixEntry : iterUV->second)
+            {
+                if (matrixEntry.second.count(pCluster))
+                {
+                    this->RecordChange(pClusterU);
+                    this->RecordChange(matrixEntry.first);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+bool OverlapTensor<T>::HasElement(const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW) const
+{
+    typename TheTensor::const_iterator iterU(m_overlapTensor.find(pClusterU));
+
+    if (m_overlapTensor.end() == iterU)
+        return false;
+
+    typename OverlapMatrix::const_iterator iterV(iterU->second.find(pClusterV));
+
+    return ((iterU->second.end() != iterV) && (iterV->second.count(pClusterW) > 0));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void OverlapTensor<T>::GetConnectedElements(const Cluster *const pCluster, const bool ignoreUnavailable, ElementList &elementList,
     ClusterList &clusterListU, ClusterList &clusterListV, ClusterList &clusterListW) const
@@ -265,6 +404,7 @@ void OverlapTensor<T>::GetConnectedElements(const Cluster *const pCluster, const
     }
 
     std::sort(elementList.begin(), elementList.end());
+    m_nElementsVisited += elementList.size();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
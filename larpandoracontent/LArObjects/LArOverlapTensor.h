@@ -85,6 +85,11 @@ public:
 
     typedef std::vector<Element> ElementList;
 
+    /**
+     *  @brief  Default constructor
+     */
+    OverlapTensor();
+
     /**
      *  @brief  Get unambiguous elements
      *
@@ -248,6 +253,51 @@ public:
      */
     void Clear();
 
+    /**
+     *  @brief  Set whether changes to the tensor are recorded, for use by RestrictToChangesSince. Recording is disabled by default, and
+     *          any recorded changes are discarded when the setting is changed.
+     *
+     *  @param  recordChanges whether to record changes
+     */
+    void SetRecordChanges(const bool recordChanges);
+
+    /**
+     *  @brief  Record a change affecting the tensor elements connected to a specified cluster, e.g. a change in cluster availability.
+     *          Changes made via SetOverlapResult, ReplaceOverlapResult and RemoveCluster are recorded automatically. No action is
+     *          taken unless change recording is enabled.
+     *
+     *  @param  pCluster address of the cluster
+     */
+    void RecordChange(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Get the number of changes recorded since recording was enabled, for use as a marker in RestrictToChangesSince
+     *
+     *  @return the number of recorded changes
+     */
+    std::size_t GetNRecordedChanges() const;
+
+    /**
+     *  @brief  Restrict the key clusters returned by GetSortedKeyClusters and GetUnambiguousElements to those in connected regions of the
+     *          tensor containing a cluster changed since a given marker. The restriction is lifted by any modification of the tensor.
+     *
+     *  @param  changeMarker the number of recorded changes at the marker
+     */
+    void RestrictToChangesSince(const std::size_t changeMarker);
+
+    /**
+     *  @brief  Remove any restriction of the key clusters
+     */
+    void RemoveRestriction();
+
+    /**
+     *  @brief  Get the number of elements gathered by GetConnectedElements, and so by GetUnambiguousElements, since the tensor was
+     *          constructed; the difference between two calls gives the number of elements visited through these accessors in between
+     *
+     *  @return the number of elements visited
+     */
+    unsigned int GetNElementsVisited() const;
+
 private:
     /**
      *  @brief  Get elements connected to a specified cluster
@@ -272,14 +322,61 @@ private:
     void ExploreConnections(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, pandora::ClusterList &clusterListU,
         pandora::ClusterList &clusterListV, pandora::ClusterList &clusterListW) const;
 
+    /**
+     *  @brief  Whether a key cluster satisfies any current restriction
+     *
+     *  @param  pKeyCluster address of the key cluster
+     *
+     *  @return boolean
+     */
+    bool IsAllowedKeyCluster(const pandora::Cluster *const pKeyCluster) const;
+
+    typedef std::unordered_map<const pandora::Cluster*, std::size_t> ClusterToChangeMap;
+
+    /**
+     *  @brief  Whether the tensor holds an element for a specified trio of clusters
+     *
+     *  @param  pClusterU address of cluster u
+     *  @param  pClusterV address of cluster v
+     *  @param  pClusterW address of cluster w
+     *
+     *  @return boolean
+     */
+    bool HasElement(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW) const;
+
+    /**
+     *  @brief  Record changes for a cluster and for all clusters sharing a tensor element with it
+     *
+     *  @param  pCluster address of the cluster
+     */
+    void RecordConnectedChanges(const pandora::Cluster *const pCluster);
+
     TheTensor               m_overlapTensor;                ///< The overlap tensor
     ClusterNavigationMap    m_clusterNavigationMapUV;       ///< The cluster navigation map U->V
     ClusterNavigationMap    m_clusterNavigationMapVW;       ///< The cluster navigation map V->W
     ClusterNavigationMap    m_clusterNavigationMapWU;       ///< The cluster navigation map W->U
+
+    bool                    m_recordChanges;                ///< Whether changes to the tensor are recorded
+    std::size_t             m_nRecordedChanges;             ///< The number of changes recorded since recording was enabled
+    ClusterToChangeMap      m_lastChangeMap;                ///< The index of the most recent change recorded for each changed cluster
+    bool                    m_isRestricted;                 ///< Whether the key clusters are currently restricted
+    pandora::ClusterSet     m_allowedKeyClusters;           ///< The allowed key clusters, if restricted
+    mutable unsigned int    m_nElementsVisited;             ///< The number of elements gathered by GetConnectedElements
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+inline OverlapTensor<T>::OverlapTensor() :
+    m_recordChanges(false),
+    m_nRecordedChanges(0),
+    m_isRestricted(false),
+    m_nElementsVisited(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 inline void OverlapTensor<T>::GetNConnections(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, unsigned int &nU, unsigned int &nV,
     unsigned int &nW) const
@@ -390,6 +487,61 @@ inline void OverlapTensor<T>::Clear()
     m_clusterNavigationMapUV.clear();
     m_clusterNavigationMapVW.clear();
     m_clusterNavigationMapWU.clear();
+    m_nRecordedChanges = 0;
+    m_lastChangeMap.clear();
+    this->RemoveRestriction();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void OverlapTensor<T>::SetRecordChanges(const bool recordChanges)
+{
+    m_recordChanges = recordChanges;
+    m_nRecordedChanges = 0;
+    m_lastChangeMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void OverlapTensor<T>::RecordChange(const pandora::Cluster *const pCluster)
+{
+    if (m_recordChanges)
+        m_lastChangeMap[pCluster] = m_nRecordedChanges++;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline std::size_t OverlapTensor<T>::GetNRecordedChanges() const
+{
+    return m_nRecordedChanges;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline unsigned int OverlapTensor<T>::GetNElementsVisited() const
+{
+    return m_nElementsVisited;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void OverlapTensor<T>::RemoveRestriction()
+{
+    m_isRestricted = false;
+    m_allowedKeyClusters.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline bool OverlapTensor<T>::IsAllowedKeyCluster(const pandora::Cluster *const pKeyCluster) const
+{
+    return (!m_isRestricted || (m_allowedKeyClusters.count(pKeyCluster) > 0));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
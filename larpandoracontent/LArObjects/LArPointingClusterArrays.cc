@@ -0,0 +1,57 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArPointingClusterArrays.cc
+ *
+ *  @brief  Implementation of the lar pointing cluster arrays class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArObjects/LArPointingClusterArrays.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+void LArPointingClusterArrays::Fill(const LArPointingClusterList &pointingClusterList)
+{
+    for (VertexArrays *const pVertexArrays : {&m_innerVertices, &m_outerVertices})
+    {
+        pVertexArrays->m_clusters.clear();
+        pVertexArrays->m_clusters.reserve(pointingClusterList.size());
+
+        for (FloatVector *const pArray : {&pVertexArrays->m_hadronicEnergy, &pVertexArrays->m_positionX, &pVertexArrays->m_positionY,
+            &pVertexArrays->m_positionZ, &pVertexArrays->m_directionX, &pVertexArrays->m_directionY, &pVertexArrays->m_directionZ})
+        {
+            pArray->clear();
+            pArray->reserve(pointingClusterList.size());
+        }
+    }
+
+    for (const LArPointingCluster &pointingCluster : pointingClusterList)
+    {
+        LArPointingClusterArrays::AddVertex(pointingCluster.GetInnerVertex(), m_innerVertices);
+        LArPointingClusterArrays::AddVertex(pointingCluster.GetOuterVertex(), m_outerVertices);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPointingClusterArrays::AddVertex(const LArPointingCluster::Vertex &vertex, VertexArrays &vertexArrays)
+{
+    const CartesianVector &position(vertex.GetPosition());
+    const CartesianVector &direction(vertex.GetDirection());
+
+    vertexArrays.m_clusters.push_back(vertex.GetCluster());
+    vertexArrays.m_hadronicEnergy.push_back(vertex.GetCluster()->GetHadronicEnergy());
+    vertexArrays.m_positionX.push_back(position.GetX());
+    vertexArrays.m_positionY.push_back(position.GetY());
+    vertexArrays.m_positionZ.push_back(position.GetZ());
+    vertexArrays.m_directionX.push_back(direction.GetX());
+    vertexArrays.m_directionY.push_back(direction.GetY());
+    vertexArrays.m_directionZ.push_back(direction.GetZ());
+}
+
+} // namespace lar_content
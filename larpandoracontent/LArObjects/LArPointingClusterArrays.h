@@ -0,0 +1,135 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArPointingClusterArrays.h
+ *
+ *  @brief  Header file for the lar pointing cluster arrays class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_POINTING_CLUSTER_ARRAYS_H
+#define LAR_POINTING_CLUSTER_ARRAYS_H 1
+
+#include "larpandoracontent/LArObjects/LArPointingCluster.h"
+
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArPointingClusterArrays class, holding the inner and outer vertices of a list of pointing clusters as a structure of arrays, so
+ *          that one position or vertex can be tested against many pointing cluster vertices in a single loop over contiguous arrays. The batched
+ *          functions in LArPointingClusterHelper give results identical to the corresponding scalar functions. The arrays can be refilled
+ *          for a new list of pointing clusters, reusing their storage.
+ */
+class LArPointingClusterArrays
+{
+public:
+    typedef std::vector<unsigned char> FlagVector;
+
+    /**
+     *  @brief  VertexArrays class, holding the properties of one vertex, inner or outer, of each pointing cluster
+     */
+    class VertexArrays
+    {
+    public:
+        pandora::ClusterVector      m_clusters;             ///< The addresses of the clusters
+        pandora::FloatVector        m_hadronicEnergy;       ///< The cluster hadronic energies
+        pandora::FloatVector        m_positionX;            ///< The vertex x positions
+        pandora::FloatVector        m_positionY;            ///< The vertex y positions
+        pandora::FloatVector        m_positionZ;            ///< The vertex z positions
+        pandora::FloatVector        m_directionX;           ///< The vertex direction x components
+        pandora::FloatVector        m_directionY;           ///< The vertex direction y components
+        pandora::FloatVector        m_directionZ;           ///< The vertex direction z components
+    };
+
+    /**
+     *  @brief  IntersectionArrays class, holding the intersections of one vertex with each vertex in a set of vertex arrays
+     */
+    class IntersectionArrays
+    {
+    public:
+        pandora::FloatVector        m_positionX;            ///< The intersection x positions
+        pandora::FloatVector        m_positionY;            ///< The intersection y positions
+        pandora::FloatVector        m_positionZ;            ///< The intersection z positions
+        pandora::FloatVector        m_firstDisplacement;    ///< The displacements of the intersections from the first vertex
+        pandora::FloatVector        m_secondDisplacement;   ///< The displacements of the intersections from the second vertices
+        FlagVector                  m_isValid;              ///< Whether each intersection is defined
+    };
+
+    /**
+     *  @brief  DirectionArrays class, holding a direction for each vertex in a set of vertex arrays
+     */
+    class DirectionArrays
+    {
+    public:
+        pandora::FloatVector        m_directionX;           ///< The direction x components
+        pandora::FloatVector        m_directionY;           ///< The direction y components
+        pandora::FloatVector        m_directionZ;           ///< The direction z components
+        FlagVector                  m_isValid;              ///< Whether each direction is defined
+    };
+
+    /**
+     *  @brief  Set the arrays to hold the vertices of a list of pointing clusters, replacing any existing contents
+     *
+     *  @param  pointingClusterList the list of pointing clusters
+     */
+    void Fill(const LArPointingClusterList &pointingClusterList);
+
+    /**
+     *  @brief  Get the number of pointing clusters
+     *
+     *  @return the number of pointing clusters
+     */
+    unsigned int GetSize() const;
+
+    /**
+     *  @brief  Get the inner vertices
+     *
+     *  @return the inner vertex arrays
+     */
+    const VertexArrays &GetInnerVertices() const;
+
+    /**
+     *  @brief  Get the outer vertices
+     *
+     *  @return the outer vertex arrays
+     */
+    const VertexArrays &GetOuterVertices() const;
+
+private:
+    /**
+     *  @brief  Add a vertex to a set of vertex arrays
+     *
+     *  @param  vertex the vertex
+     *  @param  vertexArrays the vertex arrays
+     */
+    static void AddVertex(const LArPointingCluster::Vertex &vertex, VertexArrays &vertexArrays);
+
+    VertexArrays                    m_innerVertices;        ///< The inner vertices
+    VertexArrays                    m_outerVertices;        ///< The outer vertices
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int LArPointingClusterArrays::GetSize() const
+{
+    return m_innerVertices.m_positionX.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const LArPointingClusterArrays::VertexArrays &LArPointingClusterArrays::GetInnerVertices() const
+{
+    return m_innerVertices;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const LArPointingClusterArrays::VertexArrays &LArPointingClusterArrays::GetOuterVertices() const
+{
+    return m_outerVertices;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_POINTING_CLUSTER_ARRAYS_H
@@ -0,0 +1,175 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArSlidingFitCache.cc
+ *
+ *  @brief  Implementation of the lar sliding fit cache class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArObjects/LArSlidingFitCache.h"
+
+#include <iostream>
+#include <utility>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+TwoDSlidingFitResultPtr SlidingFitCache::GetSlidingFitResult(const Process &process, const Cluster *const pCluster,
+    const unsigned int layerFitHalfWindow, const float layerPitch)
+{
+    SlidingFitCache &cache(SlidingFitCache::GetCache(process.GetPandora()));
+    const Key key(pCluster, layerFitHalfWindow, layerPitch);
+    CaloHitVector caloHitVector;
+    SlidingFitCache::GetCaloHits(pCluster, caloHitVector);
+    unsigned int epoch(0);
+
+    {
+        std::lock_guard<std::mutex> lock(cache.m_mutex);
+        epoch = cache.m_epoch;
+
+        if (cache.m_statisticsMap.find(&process) == cache.m_statisticsMap.end())
+            cache.m_processVector.push_back(&process);
+
+        Statistics &statistics(cache.m_statisticsMap[&process]);
+        EntryMap::const_iterator iter(cache.m_entryMap.find(key));
+
+        if (cache.m_entryMap.end() != iter)
+        {
+            const Entry &entry(iter->second);
+
+            // ATTN Compare exact hit membership, as a cluster created during the event may reuse the address of a deleted cluster
+            if ((entry.m_epoch == epoch) && (entry.m_caloHitVector == caloHitVector))
+            {
+                ++statistics.m_nHits;
+                return entry.m_spSlidingFitResult;
+            }
+
+            ++statistics.m_nInvalidations;
+        }
+
+        ++statistics.m_nMisses;
+    }
+
+    // ATTN Fit outside the lock, so that independent fits are not serialised. Fit failures are not stored and are raised on every request.
+    TwoDSlidingFitResultPtr spSlidingFitResult(std::make_shared<const TwoDSlidingFitResult>(pCluster, layerFitHalfWindow, layerPitch));
+
+    std::lock_guard<std::mutex> lock(cache.m_mutex);
+
+    // ATTN A fit begun before a reset belongs to the previous event and is not stored
+    if (cache.m_epoch == epoch)
+    {
+        Entry &entry(cache.m_entryMap[key]);
+        entry.m_caloHitVector = std::move(caloHitVector);
+        entry.m_epoch = epoch;
+        entry.m_spSlidingFitResult = spSlidingFitResult;
+    }
+
+    return spSlidingFitResult;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+SlidingFitCache::Statistics SlidingFitCache::GetStatistics(const Process &process)
+{
+    SlidingFitCache &cache(SlidingFitCache::GetCache(process.GetPandora()));
+
+    std::lock_guard<std::mutex> lock(cache.m_mutex);
+    StatisticsMap::const_iterator iter(cache.m_statisticsMap.find(&process));
+
+    return ((cache.m_statisticsMap.end() != iter) ? iter->second : Statistics());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SlidingFitCache::Reset(const Pandora &pandora)
+{
+    SlidingFitCache &cache(SlidingFitCache::GetCache(pandora));
+
+    std::lock_guard<std::mutex> lock(cache.m_mutex);
+
+    if (pandora.GetSettings()->ShouldDisplayAlgorithmInfo())
+    {
+        for (const Process *const pProcess : cache.m_processVector)
+        {
+            const Statistics &statistics(cache.m_statisticsMap.at(pProcess));
+            std::cout << "SlidingFitCache: " << pProcess->GetType() << " (" << pProcess->GetInstanceName() << "), hits " << statistics.m_nHits
+                      << ", misses " << statistics.m_nMisses << ", invalidations " << statistics.m_nInvalidations << std::endl;
+        }
+    }
+
+    ++cache.m_epoch;
+    cache.m_entryMap.clear();
+    cache.m_statisticsMap.clear();
+    cache.m_processVector.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SlidingFitCache::Release(const Pandora &pandora)
+{
+    std::unique_lock<std::shared_mutex> lock(SlidingFitCache::GetCacheMapMutex());
+    SlidingFitCache::GetCacheMap().erase(&pandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+SlidingFitCache::SlidingFitCache() :
+    m_epoch(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+SlidingFitCache &SlidingFitCache::GetCache(const Pandora &pandora)
+{
+    CacheMap &cacheMap(SlidingFitCache::GetCacheMap());
+
+    {
+        std::shared_lock<std::shared_mutex> lock(SlidingFitCache::GetCacheMapMutex());
+        CacheMap::const_iterator iter(cacheMap.find(&pandora));
+
+        if (cacheMap.end() != iter)
+            return *(iter->second);
+    }
+
+    std::unique_lock<std::shared_mutex> lock(SlidingFitCache::GetCacheMapMutex());
+    std::unique_ptr<SlidingFitCache> &pCache(cacheMap[&pandora]);
+
+    if (!pCache)
+        pCache.reset(new SlidingFitCache);
+
+    return *pCache;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+SlidingFitCache::CacheMap &SlidingFitCache::GetCacheMap()
+{
+    static CacheMap cacheMap;
+    return cacheMap;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::shared_mutex &SlidingFitCache::GetCacheMapMutex()
+{
+    static std::shared_mutex cacheMapMutex;
+    return cacheMapMutex;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SlidingFitCache::GetCaloHits(const Cluster *const pCluster, CaloHitVector &caloHitVector)
+{
+    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+    caloHitVector.reserve(pCluster->GetNCaloHits());
+
+    for (const OrderedCaloHitList::value_type &layerEntry : orderedCaloHitList)
+        caloHitVector.insert(caloHitVector.end(), layerEntry.second->begin(), layerEntry.second->end());
+}
+
+} // namespace lar_content
@@ -0,0 +1,172 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArSlidingFitCache.h
+ *
+ *  @brief  Header file for the lar sliding fit cache class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_SLIDING_FIT_CACHE_H
+#define LAR_SLIDING_FIT_CACHE_H 1
+
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace pandora
+{
+class Process;
+}
+
+namespace lar_content
+{
+
+typedef std::shared_ptr<const TwoDSlidingFitResult> TwoDSlidingFitResultPtr;
+typedef std::unordered_map<const pandora::Cluster*, TwoDSlidingFitResultPtr> TwoDSlidingFitResultPtrMap;
+
+/**
+ *  @brief  SlidingFitCache class, holding the two dimensional sliding fits made to clusters by any algorithm during a single event.
+ *          Fits are keyed on (cluster, layer fit half window, layer pitch). A stored fit is only returned while the cluster at that
+ *          address holds exactly the same calo hits, in the same order, as when it was fitted, so fits to clusters that have since been
+ *          modified, merged or deleted (including new clusters created at a reused address) are redone on their next use. The cache
+ *          for each pandora instance is reset at the end of each event by every algorithm and algorithm tool that uses it, from its
+ *          pandora per-event reset, and released with the instance by the master algorithm that owns it.
+ */
+class SlidingFitCache
+{
+public:
+    /**
+     *  @brief  Statistics class, recording the use of the cache by a single algorithm or algorithm tool
+     */
+    class Statistics
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Statistics();
+
+        unsigned int    m_nHits;                ///< The number of requests satisfied by a stored fit
+        unsigned int    m_nMisses;              ///< The number of requests requiring a new fit
+        unsigned int    m_nInvalidations;       ///< The number of misses for which a stored fit was found to be out of date
+    };
+
+    /**
+     *  @brief  Get the sliding fit result for a cluster, using a stored fit if the cluster is unchanged since it was made
+     *
+     *  @param  process the algorithm or algorithm tool requesting the fit, to which the cache statistics are attributed
+     *  @param  pCluster address of the cluster
+     *  @param  layerFitHalfWindow the layer fit half window
+     *  @param  layerPitch the layer pitch, units cm
+     *
+     *  @return the sliding fit result
+     *
+     *  @throws StatusCodeException if the fit cannot be made
+     */
+    static TwoDSlidingFitResultPtr GetSlidingFitResult(const pandora::Process &process, const pandora::Cluster *const pCluster,
+        const unsigned int layerFitHalfWindow, const float layerPitch);
+
+    /**
+     *  @brief  Get the cache statistics for an algorithm or algorithm tool in the current event
+     *
+     *  @param  process the algorithm or algorithm tool
+     *
+     *  @return the cache statistics
+     */
+    static Statistics GetStatistics(const pandora::Process &process);
+
+    /**
+     *  @brief  Reset the cache for a pandora instance at the end of an event, advancing the event epoch and reporting the statistics
+     *          for each algorithm if the pandora settings request display of algorithm information. To be called from the per-event
+     *          reset of each algorithm and algorithm tool using the cache; resets after the first in an event find the cache empty.
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Reset(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Release the cache for a pandora instance that is being deleted
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Release(const pandora::Pandora &pandora);
+
+private:
+    typedef std::tuple<const pandora::Cluster*, unsigned int, float> Key;
+
+    /**
+     *  @brief  Entry class
+     */
+    class Entry
+    {
+    public:
+        pandora::CaloHitVector      m_caloHitVector;        ///< The calo hits in the cluster when fitted, in ordered calo hit list order
+        unsigned int                m_epoch;                ///< The event epoch in which the fit was made
+        TwoDSlidingFitResultPtr     m_spSlidingFitResult;   ///< The sliding fit result
+    };
+
+    typedef std::map<Key, Entry> EntryMap;
+    typedef std::map<const pandora::Process*, Statistics> StatisticsMap;
+    typedef std::vector<const pandora::Process*> ProcessVector;
+    typedef std::unordered_map<const pandora::Pandora*, std::unique_ptr<SlidingFitCache>> CacheMap;
+
+    /**
+     *  @brief  Default constructor
+     */
+    SlidingFitCache();
+
+    /**
+     *  @brief  Get the cache for a pandora instance, creating it if required
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return the cache
+     */
+    static SlidingFitCache &GetCache(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Get the caches for all pandora instances
+     *
+     *  @return the cache map
+     */
+    static CacheMap &GetCacheMap();
+
+    /**
+     *  @brief  Get the mutex protecting the cache map, held exclusively only while a cache is created or released
+     *
+     *  @return the mutex
+     */
+    static std::shared_mutex &GetCacheMapMutex();
+
+    /**
+     *  @brief  Get the calo hits in a cluster, in ordered calo hit list order
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  caloHitVector to receive the calo hits
+     */
+    static void GetCaloHits(const pandora::Cluster *const pCluster, pandora::CaloHitVector &caloHitVector);
+
+    std::mutex              m_mutex;                ///< The mutex protecting this cache
+    unsigned int            m_epoch;                ///< The event epoch, advanced by each reset
+    EntryMap                m_entryMap;             ///< The stored fits
+    StatisticsMap           m_statisticsMap;        ///< The statistics for each algorithm or algorithm tool
+    ProcessVector           m_processVector;        ///< The algorithms and algorithm tools using the cache, in order of first use
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline SlidingFitCache::Statistics::Statistics() :
+    m_nHits(0),
+    m_nMisses(0),
+    m_nInvalidations(0)
+{
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_SLIDING_FIT_CACHE_H
@@ -44,8 +44,15 @@ float SimpleCone::GetBoundedHitFraction(const Cluster *const pCluster, const flo
     CartesianPointVector hitPositionVector;
     LArClusterHelper::GetCoordinateVector(pCluster, hitPositionVector);
 
+    return this->GetBoundedHitFraction(hitPositionVector, coneLength, coneTanHalfAngle);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float SimpleCone::GetBoundedHitFraction(const CartesianPointVector &hitPositionVector, const float coneLength, const float coneTanHalfAngle) const
+{
     unsigned int nMatchedHits(0);
-    const unsigned int nClusterHits(pCluster->GetNCaloHits());
+    const unsigned int nClusterHits(hitPositionVector.size());
 
     for (const CartesianVector &hitPosition : hitPositionVector)
     {
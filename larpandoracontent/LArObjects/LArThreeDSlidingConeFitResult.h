@@ -103,6 +103,17 @@ public:
      */
     float GetBoundedHitFraction(const pandora::Cluster *const pCluster, const float coneLength, const float coneTanHalfAngle) const;
 
+    /**
+     *  @brief  Get the fraction of a provided set of hit positions that are bounded within the cone, using provided cone angle and length
+     *
+     *  @param  hitPositionVector the hit positions
+     *  @param  coneLength the provided cone length
+     *  @param  coneTanHalfAngle the provided tangent of the cone half-angle
+     *
+     *  @return the bounded hit fraction
+     */
+    float GetBoundedHitFraction(const pandora::CartesianPointVector &hitPositionVector, const float coneLength, const float coneTanHalfAngle) const;
+
 private:
     pandora::CartesianVector        m_coneApex;                 ///< The cone apex
     pandora::CartesianVector        m_coneDirection;            ///< The cone direction
@@ -0,0 +1,166 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTrainingExampleSink.cc
+ *
+ *  @brief  Implementation of the lar training example sink class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArObjects/LArTrainingExampleSink.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+TrainingExampleSink::~TrainingExampleSink()
+{
+    this->Flush();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TrainingExampleSink::AddExample(const std::string &trainingOutputFile, const MvaTypes::MvaFeatureVector &featureVector,
+    const bool result, const bool writeBinary)
+{
+    std::lock_guard<std::mutex> lock(TrainingExampleSink::GetMutex());
+    std::unique_ptr<TrainingExampleSink> &pSink(TrainingExampleSink::GetSinkMap()[trainingOutputFile]);
+
+    if (!pSink)
+        pSink.reset(new TrainingExampleSink(trainingOutputFile));
+
+    return pSink->Add(featureVector, result, writeBinary);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TrainingExampleSink::FlushAll()
+{
+    std::lock_guard<std::mutex> lock(TrainingExampleSink::GetMutex());
+    StatusCode statusCode(STATUS_CODE_SUCCESS);
+
+    for (SinkMap::value_type &mapEntry : TrainingExampleSink::GetSinkMap())
+    {
+        if (STATUS_CODE_SUCCESS != mapEntry.second->Flush())
+            statusCode = STATUS_CODE_FAILURE;
+    }
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TrainingExampleSink::TrainingExampleSink(const std::string &trainingOutputFile) :
+    m_textFileName(trainingOutputFile),
+    m_binaryFileName(trainingOutputFile + ".bin"),
+    m_timestamp(static_cast<std::time_t>(-1))
+{
+    m_textBuffer.reserve(m_blockSize + 4096);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TrainingExampleSink::SinkMap &TrainingExampleSink::GetSinkMap()
+{
+    // ATTN Destroyed at process exit, when the remaining examples are written
+    static SinkMap sinkMap;
+    return sinkMap;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::mutex &TrainingExampleSink::GetMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TrainingExampleSink::Add(const MvaTypes::MvaFeatureVector &featureVector, const bool result, const bool writeBinary)
+{
+    const std::time_t timestampNow(std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()));
+
+    if (timestampNow != m_timestamp)
+    {
+        char buffer[80];
+        const std::size_t length(std::strftime(buffer, 80, "%x_%X", std::localtime(&timestampNow)));
+
+        m_timestamp = timestampNow;
+        m_timestampString.assign(buffer, length);
+    }
+
+    // ATTN Format the whole example before appending it, so that an uninitialized feature leaves no partial line. Features are formatted
+    // as by a default std::ostream, i.e. %g
+    std::string line(m_timestampString);
+    line.push_back(',');
+
+    char buffer[32];
+
+    for (const MvaTypes::MvaFeature &feature : featureVector)
+    {
+        const int length(std::snprintf(buffer, sizeof(buffer), "%g", feature.Get()));
+        line.append(buffer, length);
+        line.push_back(',');
+    }
+
+    line.push_back(result ? '1' : '0');
+    line.push_back('\n');
+    m_textBuffer.append(line);
+
+    if (writeBinary)
+    {
+        TrainingExampleSink::AppendBytes(static_cast<std::int64_t>(timestampNow), m_binaryBuffer);
+        TrainingExampleSink::AppendBytes(static_cast<std::uint32_t>(featureVector.size()), m_binaryBuffer);
+
+        for (const MvaTypes::MvaFeature &feature : featureVector)
+            TrainingExampleSink::AppendBytes(feature.Get(), m_binaryBuffer);
+
+        TrainingExampleSink::AppendBytes(static_cast<std::uint8_t>(result), m_binaryBuffer);
+    }
+
+    if ((m_textBuffer.size() < m_blockSize) && (m_binaryBuffer.size() < m_blockSize))
+        return STATUS_CODE_SUCCESS;
+
+    return this->Flush();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TrainingExampleSink::Flush()
+{
+    const StatusCode textStatusCode(TrainingExampleSink::AppendToFile(m_textFileName, m_textBuffer, false));
+    const StatusCode binaryStatusCode(TrainingExampleSink::AppendToFile(m_binaryFileName, m_binaryBuffer, true));
+
+    return (((STATUS_CODE_SUCCESS == textStatusCode) && (STATUS_CODE_SUCCESS == binaryStatusCode)) ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TrainingExampleSink::AppendToFile(const std::string &fileName, std::string &buffer, const bool isBinary)
+{
+    if (buffer.empty())
+        return STATUS_CODE_SUCCESS;
+
+    std::ofstream outfile(fileName, isBinary ? (std::ios_base::app | std::ios_base::binary) : std::ios_base::app);
+
+    if (!outfile.is_open())
+    {
+        // ATTN Nothing has been written, so keep the buffer for the next flush
+        std::cout << "TrainingExampleSink: could not open file for training examples at " << fileName << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    outfile.write(buffer.data(), buffer.size());
+    buffer.clear();
+
+    return (outfile.good() ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE);
+}
+
+} // namespace lar_content
@@ -0,0 +1,146 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTrainingExampleSink.h
+ *
+ *  @brief  Header file for the lar training example sink class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_TRAINING_EXAMPLE_SINK_H
+#define LAR_TRAINING_EXAMPLE_SINK_H 1
+
+#include "larpandoracontent/LArObjects/LArMvaInterface.h"
+
+#include "Pandora/StatusCodes.h"
+
+#include <ctime>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  TrainingExampleSink class, collecting the mva training examples for a single output file in memory and appending them to the file
+ *          in blocks. There is one sink per output file name for the lifetime of the process, shared by all algorithms and pandora
+ *          instances. The algorithms producing examples call FlushAll at the end of each event, so that the files are complete after each
+ *          event; any examples still held are also written when the process ends.
+ *
+ *          Examples are written to the named file as text lines: a timestamp, the features and the result, separated by commas. Examples
+ *          may also be written to a binary file, named by appending ".bin" to the output file name, holding one record per example: the
+ *          timestamp in seconds (int64), the number of features (uint32), the features (float64) and the result (uint8), in native
+ *          byte order and without padding.
+ */
+class TrainingExampleSink
+{
+public:
+    /**
+     *  @brief  Destructor, writing any examples still held
+     */
+    ~TrainingExampleSink();
+
+    /**
+     *  @brief  Add a training example to the sink for an output file
+     *
+     *  @param  trainingOutputFile the output file name
+     *  @param  featureVector the features
+     *  @param  result the result
+     *  @param  writeBinary whether to also write the example to the binary file
+     *
+     *  @return success
+     */
+    static pandora::StatusCode AddExample(const std::string &trainingOutputFile, const MvaTypes::MvaFeatureVector &featureVector,
+        const bool result, const bool writeBinary);
+
+    /**
+     *  @brief  Write the examples held by every sink to their output files. Examples for a file that cannot be opened are kept, to be
+     *          written by a later flush
+     *
+     *  @return success, or failure if any output file could not be written
+     */
+    static pandora::StatusCode FlushAll();
+
+private:
+    typedef std::map<std::string, std::unique_ptr<TrainingExampleSink>> SinkMap;
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  trainingOutputFile the output file name
+     */
+    TrainingExampleSink(const std::string &trainingOutputFile);
+
+    /**
+     *  @brief  Get the sinks, keyed by output file name
+     *
+     *  @return the sinks
+     */
+    static SinkMap &GetSinkMap();
+
+    /**
+     *  @brief  Get the mutex protecting the sinks
+     *
+     *  @return the mutex
+     */
+    static std::mutex &GetMutex();
+
+    /**
+     *  @brief  Add a training example to this sink
+     *
+     *  @param  featureVector the features
+     *  @param  result the result
+     *  @param  writeBinary whether to also write the example to the binary file
+     *
+     *  @return success
+     */
+    pandora::StatusCode Add(const MvaTypes::MvaFeatureVector &featureVector, const bool result, const bool writeBinary);
+
+    /**
+     *  @brief  Write the examples held by this sink to its output files
+     *
+     *  @return success
+     */
+    pandora::StatusCode Flush();
+
+    /**
+     *  @brief  Append a buffer to a file, clearing the buffer once written. If the file cannot be opened, the buffer is kept.
+     *
+     *  @param  fileName the file name
+     *  @param  buffer the buffer
+     *  @param  isBinary whether to open the file in binary mode
+     *
+     *  @return success
+     */
+    static pandora::StatusCode AppendToFile(const std::string &fileName, std::string &buffer, const bool isBinary);
+
+    /**
+     *  @brief  Append the bytes of a value to a buffer
+     *
+     *  @param  value the value
+     *  @param  buffer the buffer
+     */
+    template <typename T>
+    static void AppendBytes(const T value, std::string &buffer);
+
+    static const std::size_t m_blockSize = 1 << 20;     ///< The number of bytes held for either file before the examples are written
+
+    const std::string   m_textFileName;                 ///< The text output file name
+    const std::string   m_binaryFileName;               ///< The binary output file name
+    std::string         m_textBuffer;                   ///< The text held for the text output file
+    std::string         m_binaryBuffer;                 ///< The records held for the binary output file
+    std::time_t         m_timestamp;                    ///< The time at which the timestamp string was last formatted
+    std::string         m_timestampString;              ///< The timestamp string for that time
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void TrainingExampleSink::AppendBytes(const T value, std::string &buffer)
+{
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_TRAINING_EXAMPLE_SINK_H
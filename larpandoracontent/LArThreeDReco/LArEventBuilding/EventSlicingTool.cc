@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
 
@@ -35,6 +36,7 @@ EventSlicingTool::EventSlicingTool() :
     m_minHitsPer3DCluster(20),
     m_min3DHitsToSeedNewSlice(50),
     m_halfWindowLayers(20),
+    m_nThreads(1),
     m_usePointingAssociation(true),
     m_minVertexLongitudinalDistance(-7.5f),
     m_maxVertexLongitudinalDistance(60.f),
@@ -170,25 +172,33 @@ void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, c
     const float layerPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
     ThreeDSlidingFitResultMap trackFitResults;
+    LArParallelHelper::ClusterFailureList trackFitFailures;
 
-    for (const Cluster *const pCluster3D : trackClusters3D)
-    {
-        try {trackFitResults.insert(ThreeDSlidingFitResultMap::value_type(pCluster3D, ThreeDSlidingFitResult(pCluster3D, m_halfWindowLayers, layerPitch)));}
-        catch (StatusCodeException &) {std::cout << "EventSlicingTool: ThreeDSlidingFitResult failure for track cluster." << std::endl;}
-    }
+    LArParallelHelper::FitClusters(ClusterVector(trackClusters3D.begin(), trackClusters3D.end()), m_nThreads, [&](const Cluster *const pCluster3D) {
+        return ThreeDSlidingFitResult(pCluster3D, m_halfWindowLayers, layerPitch);
+    }, trackFitResults, trackFitFailures);
+
+    for (unsigned int iFailure = 0; iFailure < trackFitFailures.size(); ++iFailure)
+        std::cout << "EventSlicingTool: ThreeDSlidingFitResult failure for track cluster." << std::endl;
 
     ThreeDSlidingConeFitResultMap showerConeFitResults;
+    LArParallelHelper::ClusterFailureList showerConeFitFailures;
 
-    for (const Cluster *const pCluster3D : showerClusters3D)
-    {
-        try {showerConeFitResults.insert(ThreeDSlidingConeFitResultMap::value_type(pCluster3D, ThreeDSlidingConeFitResult(pCluster3D, m_halfWindowLayers, layerPitch)));}
-        catch (StatusCodeException &) {std::cout << "EventSlicingTool: ThreeDSlidingConeFitResult failure for shower cluster." << std::endl;}
-    }
+    LArParallelHelper::FitClusters(ClusterVector(showerClusters3D.begin(), showerClusters3D.end()), m_nThreads, [&](const Cluster *const pCluster3D) {
+        return ThreeDSlidingConeFitResult(pCluster3D, m_halfWindowLayers, layerPitch);
+    }, showerConeFitResults, showerConeFitFailures);
+
+    for (unsigned int iFailure = 0; iFailure < showerConeFitFailures.size(); ++iFailure)
+        std::cout << "EventSlicingTool: ThreeDSlidingConeFitResult failure for shower cluster." << std::endl;
 
     ClusterVector sortedClusters3D(trackClusters3D.begin(), trackClusters3D.end());
     sortedClusters3D.insert(sortedClusters3D.end(), showerClusters3D.begin(), showerClusters3D.end());
     std::sort(sortedClusters3D.begin(), sortedClusters3D.end(), LArClusterHelper::SortByNHits);
 
+    AssociationCache associationCache;
+    this->FillAssociationCache(sortedClusters3D, trackFitResults, showerConeFitResults, associationCache);
+    const AssociationIndex associationIndex(sortedClusters3D, associationCache);
+
     ClusterSet usedClusters;
 
     for (const Cluster *const pCluster3D : sortedClusters3D)
@@ -203,50 +213,201 @@ void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, c
         usedClusters.insert(pCluster3D);
 
         ClusterVector &clusterSlice(clusterSliceList.back());
-        this->CollectAssociatedClusters(pCluster3D, sortedClusters3D, trackFitResults, showerConeFitResults, clusterSlice, usedClusters);
+        this->CollectAssociatedClusters(pCluster3D, sortedClusters3D, associationCache, associationIndex, clusterSlice, usedClusters);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void EventSlicingTool::CollectAssociatedClusters(const Cluster *const pClusterInSlice, const ClusterVector &candidateClusters,
-    const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults, ClusterVector &clusterSlice,
-    ClusterSet &usedClusters) const
+void EventSlicingTool::FillAssociationCache(const ClusterVector &clusters3D, const ThreeDSlidingFitResultMap &trackFitResults,
+    const ThreeDSlidingConeFitResultMap &showerConeFitResults, AssociationCache &associationCache) const
 {
-    ClusterVector addedClusters;
+    for (const Cluster *const pCluster3D : clusters3D)
+    {
+        CartesianPointVector coordinateVector;
+        LArClusterHelper::GetCoordinateVector(pCluster3D, coordinateVector);
+
+        if (!coordinateVector.empty())
+            associationCache.m_boundingBoxMap.insert(ClusterToBoundingBoxMap::value_type(pCluster3D, BoundingBox(coordinateVector)));
+
+        associationCache.m_coordinatesMap[pCluster3D].swap(coordinateVector);
+    }
+
+    for (const ThreeDSlidingFitResultMap::value_type &mapEntry : trackFitResults)
+    {
+        // ATTN A failure to build a pointing cluster is raised later, only if the cluster is tested for pointing association
+        try
+        {
+            associationCache.m_pointingClusterMap.insert(ClusterToPointingClusterMap::value_type(mapEntry.first, LArPointingCluster(mapEntry.second)));
+        }
+        catch (const StatusCodeException &statusCodeException)
+        {
+            associationCache.m_pointingFailureMap.insert(ClusterToStatusCodeMap::value_type(mapEntry.first, statusCodeException.GetStatusCode()));
+        }
+    }
 
-    for (const Cluster *const pCandidateCluster : candidateClusters)
+    for (const ThreeDSlidingConeFitResultMap::value_type &mapEntry : showerConeFitResults)
     {
-        if (usedClusters.count(pCandidateCluster) || (pClusterInSlice == pCandidateCluster))
+        try
+        {
+            const ThreeDSlidingConeFitResult &slidingConeFitResult3D(mapEntry.second);
+            const ThreeDSlidingFitResult &slidingFitResult3D(slidingConeFitResult3D.GetSlidingFitResult());
+
+            ConeFitDetails coneFitDetails;
+            slidingConeFitResult3D.GetSimpleConeList(m_nConeFitLayers, m_nConeFits, CONE_BOTH_DIRECTIONS, coneFitDetails.m_simpleConeList);
+            const float clusterLength((slidingFitResult3D.GetGlobalMaxLayerPosition() - slidingFitResult3D.GetGlobalMinLayerPosition()).GetMagnitude());
+            coneFitDetails.m_coneLength = std::min(m_coneLengthMultiplier * clusterLength, m_maxConeLength);
+
+            associationCache.m_coneFitDetailsMap.insert(ClusterToConeFitDetailsMap::value_type(mapEntry.first, coneFitDetails));
+        }
+        catch (const StatusCodeException &)
+        {
+        }
+    }
+
+    for (const Cluster *const pCluster3D : clusters3D)
+    {
+        // ATTN A cluster whose pointing cluster could not be built is never filtered, so its failure is raised exactly as in a full search
+        if (associationCache.m_pointingFailureMap.count(pCluster3D))
             continue;
 
-        if ((m_usePointingAssociation && this->PassPointing(pClusterInSlice, pCandidateCluster, trackFitResults)) ||
-            (m_useProximityAssociation && this->PassProximity(pClusterInSlice, pCandidateCluster)) ||
-            (m_useShowerConeAssociation && (this->PassShowerCone(pClusterInSlice, pCandidateCluster, showerConeFitResults) || this->PassShowerCone(pCandidateCluster, pClusterInSlice, showerConeFitResults))) )
+        const CartesianPointVector &coordinateVector(associationCache.m_coordinatesMap.at(pCluster3D));
+        BoundingBox extent(coordinateVector);
+        bool hasExtent(!coordinateVector.empty());
+
+        ClusterToPointingClusterMap::const_iterator pointingIter(associationCache.m_pointingClusterMap.find(pCluster3D));
+
+        if (associationCache.m_pointingClusterMap.end() != pointingIter)
+        {
+            extent.AddPosition(pointingIter->second.GetInnerVertex().GetPosition());
+            extent.AddPosition(pointingIter->second.GetOuterVertex().GetPosition());
+            hasExtent = true;
+        }
+
+        ClusterToConeFitDetailsMap::const_iterator coneIter(associationCache.m_coneFitDetailsMap.find(pCluster3D));
+
+        if (associationCache.m_coneFitDetailsMap.end() != coneIter)
         {
-            addedClusters.push_back(pCandidateCluster);
-            (void) usedClusters.insert(pCandidateCluster);
+            for (const SimpleCone &simpleCone : coneIter->second.m_simpleConeList)
+            {
+                extent.AddPosition(simpleCone.GetConeApex());
+                hasExtent = true;
+            }
         }
+
+        if (hasExtent)
+            associationCache.m_extentMap.insert(ClusterToBoundingBoxMap::value_type(pCluster3D, extent));
+    }
+
+    associationCache.m_maxDistance = this->GetMaxAssociationDistance(associationCache);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float EventSlicingTool::GetMaxAssociationDistance(const AssociationCache &associationCache) const
+{
+    float maxDistance(0.f);
+
+    if (m_usePointingAssociation)
+    {
+        // ATTN Closest approach points lie within the intercept distance of each vertex; emission and node checks bound the longitudinal
+        // and transverse impact parameters of one vertex relative to the other, with the node bounds never exceeding the emission bounds
+        const float maxLongitudinalDistance(std::max(std::fabs(m_minVertexLongitudinalDistance), m_maxVertexLongitudinalDistance));
+        const float tanSqTheta(std::pow(std::tan(M_PI * m_vertexAngularAllowance / 180.f), 2.0));
+        const float maxEmissionDistance(std::sqrt(maxLongitudinalDistance * maxLongitudinalDistance * (1.f + tanSqTheta) +
+            m_maxVertexTransverseDistance * m_maxVertexTransverseDistance));
+
+        maxDistance = std::max(maxDistance, std::max(2.f * m_maxInterceptDistance + m_maxClosestApproach, maxEmissionDistance));
+    }
+
+    if (m_useProximityAssociation)
+        maxDistance = std::max(maxDistance, std::sqrt(m_maxHitSeparationSquared));
+
+    if (m_useShowerConeAssociation)
+    {
+        // ATTN Without a positive bounded fraction requirement, a cone can provide an association at any distance
+        if ((m_coneBoundedFraction1 <= 0.f) && (m_coneBoundedFraction2 <= 0.f))
+            return std::numeric_limits<float>::infinity();
+
+        const float maxConeTanHalfAngle(std::max(m_coneTanHalfAngle1, m_coneTanHalfAngle2));
+
+        for (const ClusterToConeFitDetailsMap::value_type &mapEntry : associationCache.m_coneFitDetailsMap)
+            maxDistance = std::max(maxDistance, mapEntry.second.m_coneLength * std::sqrt(1.f + maxConeTanHalfAngle * maxConeTanHalfAngle));
     }
 
-    clusterSlice.insert(clusterSlice.end(), addedClusters.begin(), addedClusters.end());
+    // ATTN Allow for rounding in the association checks
+    return (maxDistance + 1.f);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSlicingTool::CollectAssociatedClusters(const Cluster *const pSeedCluster, const ClusterVector &candidateClusters,
+    const AssociationCache &associationCache, const AssociationIndex &associationIndex, ClusterVector &clusterSlice, ClusterSet &usedClusters) const
+{
+    // ATTN Explicit stack reproducing the depth-first order of the former recursion: the clusters added for a given cluster in the slice are
+    // each fully explored, in the order in which they were added, before moving on
+    ClusterVector clusterStack(1, pSeedCluster);
+
+    while (!clusterStack.empty())
+    {
+        const Cluster *const pClusterInSlice(clusterStack.back());
+        clusterStack.pop_back();
+
+        // ATTN The index omits only candidates too distant to pass any association check, and keeps the rest in their original order
+        UIntVector candidateIndices;
+        associationIndex.GetCandidateIndices(pClusterInSlice, candidateIndices);
 
-    for (const Cluster *const pAddedCluster : addedClusters)
-        this->CollectAssociatedClusters(pAddedCluster, candidateClusters, trackFitResults, showerConeFitResults, clusterSlice, usedClusters);
+        ClusterVector addedClusters;
+
+        for (const unsigned int candidateIndex : candidateIndices)
+        {
+            const Cluster *const pCandidateCluster(candidateClusters.at(candidateIndex));
+
+            if (usedClusters.count(pCandidateCluster) || (pClusterInSlice == pCandidateCluster))
+                continue;
+
+            if ((m_usePointingAssociation && this->PassPointing(pClusterInSlice, pCandidateCluster, associationCache)) ||
+                (m_useProximityAssociation && this->PassProximity(pClusterInSlice, pCandidateCluster, associationCache)) ||
+                (m_useShowerConeAssociation && (this->PassShowerCone(pClusterInSlice, pCandidateCluster, associationCache) ||
+                this->PassShowerCone(pCandidateCluster, pClusterInSlice, associationCache))))
+            {
+                addedClusters.push_back(pCandidateCluster);
+                (void) usedClusters.insert(pCandidateCluster);
+            }
+        }
+
+        clusterSlice.insert(clusterSlice.end(), addedClusters.begin(), addedClusters.end());
+        clusterStack.insert(clusterStack.end(), addedClusters.rbegin(), addedClusters.rend());
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool EventSlicingTool::PassPointing(const Cluster *const pClusterInSlice, const Cluster *const pCandidateCluster, const ThreeDSlidingFitResultMap &trackFitResults) const
+bool EventSlicingTool::PassPointing(const Cluster *const pClusterInSlice, const Cluster *const pCandidateCluster, const AssociationCache &associationCache) const
 {
-    ThreeDSlidingFitResultMap::const_iterator inSliceIter = trackFitResults.find(pClusterInSlice);
-    ThreeDSlidingFitResultMap::const_iterator candidateIter = trackFitResults.find(pCandidateCluster);
+    // ATTN As when pointing clusters were built for each pair, failures are raised only for pairs of clusters that both have sliding fits
+    const bool inSliceHasFit(associationCache.m_pointingClusterMap.count(pClusterInSlice) || associationCache.m_pointingFailureMap.count(pClusterInSlice));
+    const bool candidateHasFit(associationCache.m_pointingClusterMap.count(pCandidateCluster) || associationCache.m_pointingFailureMap.count(pCandidateCluster));
 
-    if ((trackFitResults.end() == inSliceIter) || (trackFitResults.end() == candidateIter))
+    if (!inSliceHasFit || !candidateHasFit)
         return false;
 
-    const LArPointingCluster inSlicePointingCluster(inSliceIter->second);
-    const LArPointingCluster candidatePointingCluster(candidateIter->second);
+    for (const Cluster *const pCluster : {pClusterInSlice, pCandidateCluster})
+    {
+        ClusterToStatusCodeMap::const_iterator failureIter(associationCache.m_pointingFailureMap.find(pCluster));
+
+        if (associationCache.m_pointingFailureMap.end() != failureIter)
+            throw StatusCodeException(failureIter->second);
+    }
+
+    ClusterToPointingClusterMap::const_iterator inSliceIter = associationCache.m_pointingClusterMap.find(pClusterInSlice);
+    ClusterToPointingClusterMap::const_iterator candidateIter = associationCache.m_pointingClusterMap.find(pCandidateCluster);
+
+    if ((associationCache.m_pointingClusterMap.end() == inSliceIter) || (associationCache.m_pointingClusterMap.end() == candidateIter))
+        return false;
+
+    const LArPointingCluster &inSlicePointingCluster(inSliceIter->second);
+    const LArPointingCluster &candidatePointingCluster(candidateIter->second);
 
     if (this->CheckClosestApproach(inSlicePointingCluster, candidatePointingCluster) ||
         this->IsEmission(inSlicePointingCluster, candidatePointingCluster) ||
@@ -260,22 +421,30 @@ bool EventSlicingTool::PassPointing(const Cluster *const pClusterInSlice, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool EventSlicingTool::PassProximity(const Cluster *const pClusterInSlice, const Cluster *const pCandidateCluster) const
+bool EventSlicingTool::PassProximity(const Cluster *const pClusterInSlice, const Cluster *const pCandidateCluster, const AssociationCache &associationCache) const
 {
-    for (const auto &orderedList1 : pClusterInSlice->GetOrderedCaloHitList())
+    ClusterToBoundingBoxMap::const_iterator inSliceIter = associationCache.m_boundingBoxMap.find(pClusterInSlice);
+    ClusterToBoundingBoxMap::const_iterator candidateIter = associationCache.m_boundingBoxMap.find(pCandidateCluster);
+
+    if ((associationCache.m_boundingBoxMap.end() == inSliceIter) || (associationCache.m_boundingBoxMap.end() == candidateIter))
+        return false;
+
+    // ATTN No pair of hits can be closer than the bounding boxes, so the hit-by-hit comparison is only needed for nearby boxes
+    if (inSliceIter->second.GetDistanceSquared(candidateIter->second) > m_maxHitSeparationSquared)
+        return false;
+
+    const CartesianPointVector &coordinateVector1(associationCache.m_coordinatesMap.at(pClusterInSlice));
+    const CartesianPointVector &coordinateVector2(associationCache.m_coordinatesMap.at(pCandidateCluster));
+
+    for (const CartesianVector &positionVector1 : coordinateVector1)
     {
-        for (const CaloHit *const pCaloHit1 : *(orderedList1.second))
-        {
-            const CartesianVector &positionVector1(pCaloHit1->GetPositionVector());
+        if (candidateIter->second.GetDistanceSquared(positionVector1) > m_maxHitSeparationSquared)
+            continue;
 
-            for (const auto &orderedList2 : pCandidateCluster->GetOrderedCaloHitList())
-            {
-                for (const CaloHit *const pCaloHit2 : *(orderedList2.second))
-                {
-                    if ((positionVector1 - pCaloHit2->GetPositionVector()).GetMagnitudeSquared() < m_maxHitSeparationSquared)
-                        return true;
-                }
-            }
+        for (const CartesianVector &positionVector2 : coordinateVector2)
+        {
+            if ((positionVector1 - positionVector2).GetMagnitudeSquared() < m_maxHitSeparationSquared)
+                return true;
         }
     }
 
@@ -284,36 +453,35 @@ bool EventSlicingTool::PassProximity(const Cluster *const pClusterInSlice, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool EventSlicingTool::PassShowerCone(const Cluster *const pConeCluster, const Cluster *const pNearbyCluster, const ThreeDSlidingConeFitResultMap &showerConeFitResults) const
+bool EventSlicingTool::PassShowerCone(const Cluster *const pConeCluster, const Cluster *const pNearbyCluster, const AssociationCache &associationCache) const
 {
-    ThreeDSlidingConeFitResultMap::const_iterator fitIter = showerConeFitResults.find(pConeCluster);
+    ClusterToConeFitDetailsMap::const_iterator fitIter = associationCache.m_coneFitDetailsMap.find(pConeCluster);
 
-    if (showerConeFitResults.end() == fitIter)
+    if (associationCache.m_coneFitDetailsMap.end() == fitIter)
         return false;
 
-    float clusterLength(0.f);
-    SimpleConeList simpleConeList;
+    const ConeFitDetails &coneFitDetails(fitIter->second);
+    const float coneLength(coneFitDetails.m_coneLength);
 
-    try
-    {
-        const ThreeDSlidingConeFitResult &slidingConeFitResult3D(fitIter->second);
-        const ThreeDSlidingFitResult &slidingFitResult3D(slidingConeFitResult3D.GetSlidingFitResult());
-        slidingConeFitResult3D.GetSimpleConeList(m_nConeFitLayers, m_nConeFits, CONE_BOTH_DIRECTIONS, simpleConeList);
-        clusterLength = (slidingFitResult3D.GetGlobalMaxLayerPosition() - slidingFitResult3D.GetGlobalMinLayerPosition()).GetMagnitude();
-    }
-    catch (const StatusCodeException &)
-    {
-        return false;
-    }
+    // ATTN A hit bounded by a cone lies within a sphere about the apex, radius the cone slant length; if a positive bounded fraction is required,
+    // a cone whose sphere cannot reach the nearby cluster cannot provide an association
+    ClusterToBoundingBoxMap::const_iterator boxIter = associationCache.m_boundingBoxMap.find(pNearbyCluster);
+    const bool useBoundingBox((associationCache.m_boundingBoxMap.end() != boxIter) &&
+        ((m_coneBoundedFraction1 > std::numeric_limits<float>::epsilon()) || (m_coneBoundedFraction2 > std::numeric_limits<float>::epsilon())));
+    const float maxConeTanHalfAngle(std::max(m_coneTanHalfAngle1, m_coneTanHalfAngle2));
+    const float coneReach(coneLength * std::sqrt(1.f + maxConeTanHalfAngle * maxConeTanHalfAngle) + 1.f);
+
+    const CartesianPointVector &coordinateVector(associationCache.m_coordinatesMap.at(pNearbyCluster));
 
-    for (const SimpleCone &simpleCone : simpleConeList)
+    for (const SimpleCone &simpleCone : coneFitDetails.m_simpleConeList)
     {
-        const float coneLength(std::min(m_coneLengthMultiplier * clusterLength, m_maxConeLength));
+        if (useBoundingBox && (boxIter->second.GetDistanceSquared(simpleCone.GetConeApex()) > coneReach * coneReach))
+            continue;
 
-        if (simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle1) < m_coneBoundedFraction1)
+        if (simpleCone.GetBoundedHitFraction(coordinateVector, coneLength, m_coneTanHalfAngle1) < m_coneBoundedFraction1)
             continue;
 
-        if (simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle2) < m_coneBoundedFraction2)
+        if (simpleCone.GetBoundedHitFraction(coordinateVector, coneLength, m_coneTanHalfAngle2) < m_coneBoundedFraction2)
             continue;
 
         return true;
@@ -675,6 +843,181 @@ bool EventSlicingTool::SortPoints(const CartesianVector *const pLhs, const Carte
     return (deltaPosition.GetY() > std::numeric_limits<float>::epsilon());
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventSlicingTool::BoundingBox::BoundingBox(const CartesianPointVector &coordinateVector) :
+    m_minPosition(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()),
+    m_maxPosition(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max())
+{
+    for (const CartesianVector &position : coordinateVector)
+        this->AddPosition(position);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSlicingTool::BoundingBox::AddPosition(const CartesianVector &position)
+{
+    m_minPosition.SetValues(std::min(m_minPosition.GetX(), position.GetX()), std::min(m_minPosition.GetY(), position.GetY()),
+        std::min(m_minPosition.GetZ(), position.GetZ()));
+    m_maxPosition.SetValues(std::max(m_maxPosition.GetX(), position.GetX()), std::max(m_maxPosition.GetY(), position.GetY()),
+        std::max(m_maxPosition.GetZ(), position.GetZ()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float EventSlicingTool::BoundingBox::GetDistanceSquared(const CartesianVector &position) const
+{
+    const float dX(std::max(0.f, std::max(m_minPosition.GetX() - position.GetX(), position.GetX() - m_maxPosition.GetX())));
+    const float dY(std::max(0.f, std::max(m_minPosition.GetY() - position.GetY(), position.GetY() - m_maxPosition.GetY())));
+    const float dZ(std::max(0.f, std::max(m_minPosition.GetZ() - position.GetZ(), position.GetZ() - m_maxPosition.GetZ())));
+
+    return (dX * dX + dY * dY + dZ * dZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float EventSlicingTool::BoundingBox::GetDistanceSquared(const BoundingBox &other) const
+{
+    const float dX(std::max(0.f, std::max(m_minPosition.GetX() - other.m_maxPosition.GetX(), other.m_minPosition.GetX() - m_maxPosition.GetX())));
+    const float dY(std::max(0.f, std::max(m_minPosition.GetY() - other.m_maxPosition.GetY(), other.m_minPosition.GetY() - m_maxPosition.GetY())));
+    const float dZ(std::max(0.f, std::max(m_minPosition.GetZ() - other.m_maxPosition.GetZ(), other.m_minPosition.GetZ() - m_maxPosition.GetZ())));
+
+    return (dX * dX + dY * dY + dZ * dZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventSlicingTool::AssociationIndex::AssociationIndex(const ClusterVector &candidateClusters, const AssociationCache &associationCache) :
+    m_maxDistance(associationCache.m_maxDistance),
+    m_extents(candidateClusters.size(), nullptr),
+    m_origin(3, 0.f),
+    m_cellSizes(3, 1.f),
+    m_nCells(3, 1)
+{
+    const bool useGrid(std::isfinite(m_maxDistance));
+    BoundingBox gridBox((CartesianPointVector()));
+
+    for (unsigned int candidateIndex = 0; candidateIndex < candidateClusters.size(); ++candidateIndex)
+    {
+        const Cluster *const pCandidateCluster(candidateClusters.at(candidateIndex));
+        m_indexMap.insert(ClusterToIndexMap::value_type(pCandidateCluster, candidateIndex));
+
+        ClusterToBoundingBoxMap::const_iterator extentIter(associationCache.m_extentMap.find(pCandidateCluster));
+
+        if (!useGrid || (associationCache.m_extentMap.end() == extentIter))
+        {
+            m_unfilteredIndices.push_back(candidateIndex);
+            continue;
+        }
+
+        m_extents.at(candidateIndex) = &extentIter->second;
+        gridBox.AddPosition(extentIter->second.GetMinPosition());
+        gridBox.AddPosition(extentIter->second.GetMaxPosition());
+    }
+
+    if (m_unfilteredIndices.size() == candidateClusters.size())
+        return;
+
+    // ATTN Cells are no smaller than the maximum association distance, with a limited number per axis to bound the cells overlapped by long clusters
+    const unsigned int maxCellsPerAxis(32);
+    const FloatVector gridMin{gridBox.GetMinPosition().GetX(), gridBox.GetMinPosition().GetY(), gridBox.GetMinPosition().GetZ()};
+    const FloatVector gridMax{gridBox.GetMaxPosition().GetX(), gridBox.GetMaxPosition().GetY(), gridBox.GetMaxPosition().GetZ()};
+
+    for (unsigned int axis = 0; axis < 3; ++axis)
+    {
+        const float span(gridMax.at(axis) - gridMin.at(axis));
+        const float nCells(std::min(static_cast<float>(maxCellsPerAxis), std::floor(span / std::max(m_maxDistance, std::numeric_limits<float>::epsilon()))));
+
+        m_origin.at(axis) = gridMin.at(axis);
+        m_nCells.at(axis) = std::max(1u, static_cast<unsigned int>(nCells));
+        m_cellSizes.at(axis) = (span > std::numeric_limits<float>::epsilon()) ? span / static_cast<float>(m_nCells.at(axis)) : 1.f;
+    }
+
+    m_cells.resize(m_nCells.at(0) * m_nCells.at(1) * m_nCells.at(2));
+
+    for (unsigned int candidateIndex = 0; candidateIndex < m_extents.size(); ++candidateIndex)
+    {
+        if (!m_extents.at(candidateIndex))
+            continue;
+
+        UIntVector minCells, maxCells;
+        this->GetCellRange(*m_extents.at(candidateIndex), 0.f, minCells, maxCells);
+
+        for (unsigned int iX = minCells.at(0); iX <= maxCells.at(0); ++iX)
+        {
+            for (unsigned int iY = minCells.at(1); iY <= maxCells.at(1); ++iY)
+            {
+                for (unsigned int iZ = minCells.at(2); iZ <= maxCells.at(2); ++iZ)
+                    m_cells.at((iX * m_nCells.at(1) + iY) * m_nCells.at(2) + iZ).push_back(candidateIndex);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSlicingTool::AssociationIndex::GetCandidateIndices(const Cluster *const pCluster, UIntVector &candidateIndices) const
+{
+    candidateIndices.clear();
+
+    ClusterToIndexMap::const_iterator indexIter(m_indexMap.find(pCluster));
+    const BoundingBox *const pExtent((m_indexMap.end() != indexIter) ? m_extents.at(indexIter->second) : nullptr);
+
+    if (!pExtent)
+    {
+        for (unsigned int candidateIndex = 0; candidateIndex < m_extents.size(); ++candidateIndex)
+            candidateIndices.push_back(candidateIndex);
+
+        return;
+    }
+
+    UIntVector minCells, maxCells;
+    this->GetCellRange(*pExtent, m_maxDistance, minCells, maxCells);
+    const float maxDistanceSquared(m_maxDistance * m_maxDistance);
+
+    for (unsigned int iX = minCells.at(0); iX <= maxCells.at(0); ++iX)
+    {
+        for (unsigned int iY = minCells.at(1); iY <= maxCells.at(1); ++iY)
+        {
+            for (unsigned int iZ = minCells.at(2); iZ <= maxCells.at(2); ++iZ)
+            {
+                for (const unsigned int candidateIndex : m_cells.at((iX * m_nCells.at(1) + iY) * m_nCells.at(2) + iZ))
+                {
+                    if (pExtent->GetDistanceSquared(*m_extents.at(candidateIndex)) <= maxDistanceSquared)
+                        candidateIndices.push_back(candidateIndex);
+                }
+            }
+        }
+    }
+
+    candidateIndices.insert(candidateIndices.end(), m_unfilteredIndices.begin(), m_unfilteredIndices.end());
+    std::sort(candidateIndices.begin(), candidateIndices.end());
+    candidateIndices.erase(std::unique(candidateIndices.begin(), candidateIndices.end()), candidateIndices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSlicingTool::AssociationIndex::GetCellRange(const BoundingBox &boundingBox, const float distance, UIntVector &minCells, UIntVector &maxCells) const
+{
+    const FloatVector minCoordinates{boundingBox.GetMinPosition().GetX(), boundingBox.GetMinPosition().GetY(), boundingBox.GetMinPosition().GetZ()};
+    const FloatVector maxCoordinates{boundingBox.GetMaxPosition().GetX(), boundingBox.GetMaxPosition().GetY(), boundingBox.GetMaxPosition().GetZ()};
+
+    minCells.clear();
+    maxCells.clear();
+
+    for (unsigned int axis = 0; axis < 3; ++axis)
+    {
+        const float maxCell(static_cast<float>(m_nCells.at(axis) - 1));
+        const float minCellPosition(std::floor((minCoordinates.at(axis) - distance - m_origin.at(axis)) / m_cellSizes.at(axis)));
+        const float maxCellPosition(std::floor((maxCoordinates.at(axis) + distance - m_origin.at(axis)) / m_cellSizes.at(axis)));
+
+        minCells.push_back(static_cast<unsigned int>(std::min(maxCell, std::max(0.f, minCellPosition))));
+        maxCells.push_back(static_cast<unsigned int>(std::min(maxCell, std::max(0.f, maxCellPosition))));
+    }
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode EventSlicingTool::ReadSettings(const TiXmlHandle xmlHandle)
@@ -694,6 +1037,9 @@ StatusCode EventSlicingTool::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "SlidingFitHalfWindow", m_halfWindowLayers));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NThreads", m_nThreads));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "UsePointingAssociation", m_usePointingAssociation));
 
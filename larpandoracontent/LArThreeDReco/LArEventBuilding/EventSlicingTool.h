@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArControlFlow/SlicingAlgorithm.h"
 
+#include "larpandoracontent/LArObjects/LArPointingCluster.h"
 #include "larpandoracontent/LArObjects/LArThreeDSlidingConeFitResult.h"
 
 #include <unordered_map>
@@ -76,49 +77,207 @@ private:
         ClusterSliceList &clusterSliceList) const;
 
     /**
-     *  @brief  Collect all clusters associated with a provided cluster
+     *  @brief  BoundingBox class, the axis-aligned extent of the hits in a 3D cluster
+     */
+    class BoundingBox
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  coordinateVector the hit positions of the cluster
+         */
+        BoundingBox(const pandora::CartesianPointVector &coordinateVector);
+
+        /**
+         *  @brief  Get the squared distance between a position and the closest point in the bounding box
+         *
+         *  @param  position the position
+         *
+         *  @return the squared distance, zero if the position is contained in the box
+         */
+        float GetDistanceSquared(const pandora::CartesianVector &position) const;
+
+        /**
+         *  @brief  Get the squared distance between the closest points in this and another bounding box
+         *
+         *  @param  other the other bounding box
+         *
+         *  @return the squared distance, zero if the boxes overlap
+         */
+        float GetDistanceSquared(const BoundingBox &other) const;
+
+        /**
+         *  @brief  Extend the bounding box, if required, to contain a position
+         *
+         *  @param  position the position
+         */
+        void AddPosition(const pandora::CartesianVector &position);
+
+        /**
+         *  @brief  Get the minimum x, y and z coordinates
+         *
+         *  @return the minimum position
+         */
+        const pandora::CartesianVector &GetMinPosition() const;
+
+        /**
+         *  @brief  Get the maximum x, y and z coordinates
+         *
+         *  @return the maximum position
+         */
+        const pandora::CartesianVector &GetMaxPosition() const;
+
+    private:
+        pandora::CartesianVector    m_minPosition;      ///< The minimum x, y and z coordinates
+        pandora::CartesianVector    m_maxPosition;      ///< The maximum x, y and z coordinates
+    };
+
+    /**
+     *  @brief  ConeFitDetails class, the cones used in shower cone association and their common cone length
+     */
+    class ConeFitDetails
+    {
+    public:
+        float                       m_coneLength;       ///< The cone length to use when calculating bounded cluster fractions
+        SimpleConeList              m_simpleConeList;   ///< The simple cone list
+    };
+
+    typedef std::unordered_map<const pandora::Cluster*, pandora::CartesianPointVector> ClusterToCoordinatesMap;
+    typedef std::unordered_map<const pandora::Cluster*, BoundingBox> ClusterToBoundingBoxMap;
+    typedef std::unordered_map<const pandora::Cluster*, LArPointingCluster> ClusterToPointingClusterMap;
+    typedef std::unordered_map<const pandora::Cluster*, ConeFitDetails> ClusterToConeFitDetailsMap;
+    typedef std::unordered_map<const pandora::Cluster*, pandora::StatusCode> ClusterToStatusCodeMap;
+
+    /**
+     *  @brief  AssociationCache class, holding the per-cluster quantities that are used repeatedly when testing pairs of clusters
+     */
+    class AssociationCache
+    {
+    public:
+        ClusterToCoordinatesMap     m_coordinatesMap;       ///< The hit positions for each cluster
+        ClusterToBoundingBoxMap     m_boundingBoxMap;       ///< The bounding box for each cluster
+        ClusterToPointingClusterMap m_pointingClusterMap;   ///< The pointing cluster for each track cluster with a sliding fit
+        ClusterToConeFitDetailsMap  m_coneFitDetailsMap;    ///< The cone fit details for each shower cluster with a sliding cone fit
+        ClusterToStatusCodeMap      m_pointingFailureMap;   ///< The pointing cluster construction failure for each track cluster affected
+        ClusterToBoundingBoxMap     m_extentMap;            ///< The box containing the hits, pointing vertices and cone apices of each cluster
+        float                       m_maxDistance;          ///< The maximum distance between the extents of a pair of associated clusters
+    };
+
+    /**
+     *  @brief  AssociationIndex class, a uniform 3D grid of the extents of the candidate clusters, used to find the candidates that may be
+     *          associated with a given cluster without testing every candidate in turn
+     */
+    class AssociationIndex
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  candidateClusters the candidate clusters
+         *  @param  associationCache the per-cluster quantities used when testing pairs of clusters
+         */
+        AssociationIndex(const pandora::ClusterVector &candidateClusters, const AssociationCache &associationCache);
+
+        /**
+         *  @brief  Get the indices of the candidate clusters whose extents lie within the maximum association distance of a given candidate
+         *
+         *  @param  pCluster the address of the candidate cluster
+         *  @param  candidateIndices to receive the indices, in increasing order, of the candidates that may be associated
+         */
+        void GetCandidateIndices(const pandora::Cluster *const pCluster, pandora::UIntVector &candidateIndices) const;
+
+    private:
+        /**
+         *  @brief  Get the range of grid cells, along each axis, overlapping a bounding box expanded by a given distance
+         *
+         *  @param  boundingBox the bounding box
+         *  @param  distance the distance by which to expand the bounding box
+         *  @param  minCells to receive the lowest overlapping cell along each axis
+         *  @param  maxCells to receive the highest overlapping cell along each axis
+         */
+        void GetCellRange(const BoundingBox &boundingBox, const float distance, pandora::UIntVector &minCells, pandora::UIntVector &maxCells) const;
+
+        typedef std::unordered_map<const pandora::Cluster*, unsigned int> ClusterToIndexMap;
+        typedef std::vector<const BoundingBox*> BoundingBoxList;
+        typedef std::vector<pandora::UIntVector> CellList;
+
+        float                       m_maxDistance;          ///< The maximum distance between the extents of a pair of associated clusters
+        ClusterToIndexMap           m_indexMap;             ///< The index of each candidate cluster
+        BoundingBoxList             m_extents;              ///< The extent of each candidate, nullptr if the candidate is never filtered
+        pandora::UIntVector         m_unfilteredIndices;    ///< The indices of the candidates that are never filtered
+        pandora::FloatVector        m_origin;               ///< The grid origin, along each axis
+        pandora::FloatVector        m_cellSizes;            ///< The grid cell size, along each axis
+        pandora::UIntVector         m_nCells;               ///< The number of grid cells, along each axis
+        CellList                    m_cells;                ///< The indices of the candidates overlapping each grid cell
+    };
+
+    /**
+     *  @brief  Calculate, once per cluster, the quantities used when testing pairs of clusters for association
      *
-     *  @param  pClusterInSlice the address of the cluster already in a slice
-     *  @param  candidateClusters the list of candidate clusters
+     *  @param  clusters3D the 3D clusters
      *  @param  trackFitResults the map of sliding fit results for track candidate clusters
-     *  @param  showerConeFitResults the map of sliding const fit results for shower candidate clusters
+     *  @param  showerConeFitResults the map of sliding cone fit results for shower candidate clusters
+     *  @param  associationCache to receive the per-cluster quantities
+     */
+    void FillAssociationCache(const pandora::ClusterVector &clusters3D, const ThreeDSlidingFitResultMap &trackFitResults,
+        const ThreeDSlidingConeFitResultMap &showerConeFitResults, AssociationCache &associationCache) const;
+
+    /**
+     *  @brief  Get the maximum distance between the extents of a pair of clusters that can pass any of the enabled association checks
+     *
+     *  @param  associationCache the per-cluster quantities used when testing pairs of clusters
+     *
+     *  @return the maximum distance, not finite if an enabled check can associate clusters at any separation
+     */
+    float GetMaxAssociationDistance(const AssociationCache &associationCache) const;
+
+    /**
+     *  @brief  Collect all clusters associated with a provided cluster, and recursively with each cluster added to the slice
+     *
+     *  @param  pSeedCluster the address of the cluster seeding the slice
+     *  @param  candidateClusters the list of candidate clusters
+     *  @param  associationCache the per-cluster quantities used when testing pairs of clusters
+     *  @param  associationIndex the index of the candidate clusters that may be associated with a given cluster
      *  @param  clusterSlice the cluster slice
      *  @param  usedClusters the list of clusters already added to slices
      */
-    void CollectAssociatedClusters(const pandora::Cluster *const pClusterInSlice, const pandora::ClusterVector &candidateClusters, const ThreeDSlidingFitResultMap &trackFitResults,
-        const ThreeDSlidingConeFitResultMap &showerConeFitResults, pandora::ClusterVector &clusterSlice, pandora::ClusterSet &usedClusters) const;
+    void CollectAssociatedClusters(const pandora::Cluster *const pSeedCluster, const pandora::ClusterVector &candidateClusters,
+        const AssociationCache &associationCache, const AssociationIndex &associationIndex, pandora::ClusterVector &clusterSlice,
+        pandora::ClusterSet &usedClusters) const;
 
     /**
      *  @brief  Compare the provided clusters to assess whether they are associated via pointing (checks association "both ways")
      *
      *  @param  pClusterInSlice address of a cluster already in the slice
      *  @param  pCandidateCluster address of the candidate cluster
-     *  @param  trackFitResults the map of sliding fit results for track candidate clusters
+     *  @param  associationCache the per-cluster quantities used when testing pairs of clusters
      *
      *  @return whether an addition to the cluster slice should be made
      */
-    bool PassPointing(const pandora::Cluster *const pClusterInSlice, const pandora::Cluster *const pCandidateCluster, const ThreeDSlidingFitResultMap &trackFitResults) const;
+    bool PassPointing(const pandora::Cluster *const pClusterInSlice, const pandora::Cluster *const pCandidateCluster, const AssociationCache &associationCache) const;
 
     /**
-     *  @brief  Compare the provided clusters to assess whether they are associated via pointing
+     *  @brief  Compare the provided clusters to assess whether they are associated via proximity
      *
      *  @param  pClusterInSlice address of a cluster already in the slice
      *  @param  pCandidateCluster address of the candidate cluster
+     *  @param  associationCache the per-cluster quantities used when testing pairs of clusters
      *
      *  @return whether an addition to the cluster slice should be made
      */
-    bool PassProximity(const pandora::Cluster *const pClusterInSlice, const pandora::Cluster *const pCandidateCluster) const;
+    bool PassProximity(const pandora::Cluster *const pClusterInSlice, const pandora::Cluster *const pCandidateCluster, const AssociationCache &associationCache) const;
 
     /**
      *  @brief  Compare the provided clusters to assess whether they are associated via cone fits to the shower cluster (single "direction" check)
      *
-     *  @param  pClusterInSlice address of a cluster already in the slice
-     *  @param  pCandidateCluster address of the candidate cluster
-     *  @param  showerConeFitResults the map of sliding cone fit results for shower candidate clusters
+     *  @param  pConeCluster address of the shower cluster providing the cone fits
+     *  @param  pNearbyCluster address of the cluster to compare with the cones
+     *  @param  associationCache the per-cluster quantities used when testing pairs of clusters
      *
      *  @return whether an addition to the cluster slice should be made
      */
-    bool PassShowerCone(const pandora::Cluster *const pConeCluster, const pandora::Cluster *const pNearbyCluster, const ThreeDSlidingConeFitResultMap &showerConeFitResults) const;
+    bool PassShowerCone(const pandora::Cluster *const pConeCluster, const pandora::Cluster *const pNearbyCluster, const AssociationCache &associationCache) const;
 
     /**
      *  @brief  Check closest approach metrics for a pair of pointing clusters
@@ -272,6 +431,7 @@ private:
     unsigned int    m_minHitsPer3DCluster;              ///< The minimum number of hits in a 3D cluster to warrant consideration in slicing
     unsigned int    m_min3DHitsToSeedNewSlice;          ///< The minimum number of hits in a 3D cluster to seed a new slice
     unsigned int    m_halfWindowLayers;                 ///< The number of layers to use for half-window of sliding fit
+    unsigned int    m_nThreads;                         ///< The maximum number of threads used to construct the sliding fits
 
     bool            m_usePointingAssociation;           ///< Whether to use pointing association
     float           m_minVertexLongitudinalDistance;    ///< Pointing association check: min longitudinal distance cut
@@ -297,6 +457,20 @@ private:
     bool            m_use3DProjectionsInHitPickUp;      ///< Whether to include 3D cluster projections when assigning remaining clusters to slices
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CartesianVector &EventSlicingTool::BoundingBox::GetMinPosition() const
+{
+    return m_minPosition;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CartesianVector &EventSlicingTool::BoundingBox::GetMaxPosition() const
+{
+    return m_maxPosition;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_EVENT_SLICING_TOOL_H
@@ -199,22 +199,7 @@ void ThreeViewLongitudinalTracksAlgorithm::CalculateOverlapResult(const TwoDSlid
 
 void ThreeViewLongitudinalTracksAlgorithm::ExamineOverlapContainer()
 {
-    unsigned int repeatCounter(0);
-
-    for (TensorToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd; )
-    {
-        if ((*iter)->Run(this, this->GetMatchingControl().GetOverlapTensor()))
-        {
-            iter = m_algorithmToolVector.begin();
-
-            if (++repeatCounter > m_nMaxTensorToolRepeats)
-                break;
-        }
-        else
-        {
-            ++iter;
-        }
-    }
+    this->GetMatchingControl().RunTensorTools(this, m_algorithmToolVector, m_nMaxTensorToolRepeats);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -21,19 +21,40 @@ StatusCode RecursivePfoMopUpAlgorithm::Run()
 {
     PfoMergeStatsList mergeStatsListBefore(this->GetPfoMergeStats());
 
+    unsigned int nIterations(0);
+    bool isConverged(false);
+
     for (unsigned int iter = 0; iter < m_maxIterations; ++iter)
     {
+        ++nIterations;
+
+        // ATTN Pfo mop up algorithms record the pfo state at the end of each run, so later passes skip pairs of pfos they left unchanged
         for (auto const &mopUpAlg : m_mopUpAlgorithms)
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunDaughterAlgorithm(*this, mopUpAlg));
 
         PfoMergeStatsList mergeStatsListAfter(this->GetPfoMergeStats());
 
         if (std::equal(mergeStatsListBefore.cbegin(), mergeStatsListBefore.cend(), mergeStatsListAfter.cbegin(), mergeStatsListAfter.cend(), PfoMergeStatsComp))
+        {
+            isConverged = true;
             break;
+        }
 
         mergeStatsListBefore = std::move(mergeStatsListAfter);
     }
 
+    // ATTN Always reported: a single line per event giving the convergence and the final number of pfos in each list
+    std::cout << "RecursivePfoMopUpAlgorithm: " << (isConverged ? "converged after " : "not converged after ") << nIterations << " iterations";
+
+    for (const std::string &pfoListName : m_pfoListNames)
+    {
+        const PfoList *pPfoList(nullptr);
+        const unsigned int nPfos((STATUS_CODE_SUCCESS == PandoraContentApi::GetList(*this, pfoListName, pPfoList)) ? pPfoList->size() : 0);
+        std::cout << ", " << pfoListName << " " << nPfos << " pfos";
+    }
+
+    std::cout << std::endl;
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -33,6 +33,9 @@ ShowerPfoMopUpAlgorithm::ShowerPfoMopUpAlgorithm() :
     m_minBoundedFractionCut = 0.f;
     m_minConsistentDirections = 1;
     m_minConsistentDirectionsTrack = 2;
+
+    // ATTN Uses VertexBasedPfoMopUpAlgorithm::Run, so with IncrementalMopUp a rerun in the same event, e.g. by RecursivePfoMopUpAlgorithm,
+    // skips pairs of pfos that this instance left unchanged; the shower association criteria depend only on the pair of pfos and the vertex
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
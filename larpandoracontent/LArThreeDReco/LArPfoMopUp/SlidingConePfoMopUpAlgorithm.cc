@@ -55,7 +55,11 @@ StatusCode SlidingConePfoMopUpAlgorithm::Run()
         return STATUS_CODE_SUCCESS;
     }
 
+    PfoSet unchangedPfos;
+    this->GetUnchangedPfos(unchangedPfos);
+
     unsigned int nIterations(0);
+    bool isConverged(false);
 
     while (nIterations++ < m_maxIterations)
     {
@@ -64,12 +68,18 @@ StatusCode SlidingConePfoMopUpAlgorithm::Run()
         this->GetThreeDClusters(clusters3D, clusterToPfoMap);
 
         ClusterMergeMap clusterMergeMap;
-        this->GetClusterMergeMap(pVertex, clusters3D, clusterToPfoMap, clusterMergeMap);
+        this->GetClusterMergeMap(pVertex, clusters3D, clusterToPfoMap, unchangedPfos, clusterMergeMap);
 
-        if (!this->MakePfoMerges(clusterToPfoMap, clusterMergeMap))
+        if (!this->MakePfoMerges(clusterToPfoMap, clusterMergeMap, unchangedPfos))
+        {
+            isConverged = true;
             break;
+        }
     }
 
+    // ATTN If stopped by the iteration limit, mergeable pairs may remain, so the next run must consider all pairs
+    this->RecordEventState(isConverged);
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -121,16 +131,33 @@ void SlidingConePfoMopUpAlgorithm::GetThreeDClusters(ClusterVector &clusters3D,
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void SlidingConePfoMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pVertex, const ClusterVector &clusters3D,
-    const ClusterToPfoMap &clusterToPfoMap, ClusterMergeMap &clusterMergeMap) const
+    const ClusterToPfoMap &clusterToPfoMap, const PfoSet &unchangedPfos, ClusterMergeMap &clusterMergeMap) const
 {
     VertexAssociationMap vertexAssociationMap;
     const float layerPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
+    // ATTN Unchanged pfos failed the merge criteria when this algorithm last ran, so only pairs including a changed pfo can now pass
+    bool hasChangedPfo(false);
+
+    for (const Cluster *const pCluster3D : clusters3D)
+    {
+        if (!unchangedPfos.count(clusterToPfoMap.at(pCluster3D)))
+        {
+            hasChangedPfo = true;
+            break;
+        }
+    }
+
     for (const Cluster *const pShowerCluster : clusters3D)
     {
         if ((pShowerCluster->GetNCaloHits() < m_minHitsToConsider3DShower) || !LArPfoHelper::IsShower(clusterToPfoMap.at(pShowerCluster)))
             continue;
 
+        const bool isShowerPfoUnchanged(unchangedPfos.count(clusterToPfoMap.at(pShowerCluster)) > 0);
+
+        if (isShowerPfoUnchanged && !hasChangedPfo)
+            continue;
+
         float coneLength(0.f);
         SimpleConeList simpleConeList;
         bool isShowerVertexAssociated(false);
@@ -157,6 +184,9 @@ void SlidingConePfoMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pVerte
             if (pNearbyCluster == pShowerCluster)
                 continue;
 
+            if (isShowerPfoUnchanged && unchangedPfos.count(clusterToPfoMap.at(pNearbyCluster)))
+                continue;
+
             ClusterMerge bestClusterMerge(nullptr, 0.f, 0.f);
 
             for (const SimpleCone &simpleCone : simpleConeList)
@@ -225,7 +255,7 @@ bool SlidingConePfoMopUpAlgorithm::IsVertexAssociated(const Cluster *const pClus
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool SlidingConePfoMopUpAlgorithm::MakePfoMerges(const ClusterToPfoMap &clusterToPfoMap, const ClusterMergeMap &clusterMergeMap) const
+bool SlidingConePfoMopUpAlgorithm::MakePfoMerges(const ClusterToPfoMap &clusterToPfoMap, const ClusterMergeMap &clusterMergeMap, PfoSet &unchangedPfos) const
 {
     ClusterVector daughterClusters;
     for (const ClusterMergeMap::value_type &mapEntry : clusterMergeMap) daughterClusters.push_back(mapEntry.first);
@@ -253,6 +283,8 @@ bool SlidingConePfoMopUpAlgorithm::MakePfoMerges(const ClusterToPfoMap &clusterT
         // Key book-keeping on clusters and use cluster->pfo lookup
         const Pfo *const pDaughterPfo(clusterToPfoMap.at(pDaughterCluster));
         const Pfo *const pParentPfo(clusterToPfoMap.at(pParentCluster));
+        (void) unchangedPfos.erase(pParentPfo);
+        (void) unchangedPfos.erase(pDaughterPfo);
         this->MergeAndDeletePfos(pParentPfo, pDaughterPfo);
         pfosMerged = true;
 
@@ -107,10 +107,11 @@ private:
      *  @param  pVertex the neutrino interaction vertex, if available
      *  @param  clusters3D the sorted list of 3d clusters
      *  @param  clusterToPfoMap the mapping from 3d cluster to pfo
+     *  @param  unchangedPfos the pfos unchanged since the last run, pairs of which need not be considered
      *  @param  clusterMergeMap to receive the populated cluster merge map
      */
     void GetClusterMergeMap(const pandora::Vertex *const pVertex, const pandora::ClusterVector &clusters3D, const ClusterToPfoMap &clusterToPfoMap,
-        ClusterMergeMap &clusterMergeMap) const;
+        const pandora::PfoSet &unchangedPfos, ClusterMergeMap &clusterMergeMap) const;
 
     typedef std::unordered_map<const pandora::Cluster*, bool> VertexAssociationMap;
 
@@ -144,10 +145,11 @@ private:
      *
      *  @param  clusterToPfoMap the mapping from 3d cluster to pfo
      *  @param  clusterMergeMap the populated cluster merge map
+     *  @param  unchangedPfos the pfos unchanged since the last run, from which the merged pfos are removed
      *
      *  @return whether a pfo merge has been made
      */
-    bool MakePfoMerges(const ClusterToPfoMap &clusterToPfoMap, const ClusterMergeMap &clusterMergeMap) const;
+    bool MakePfoMerges(const ClusterToPfoMap &clusterToPfoMap, const ClusterMergeMap &clusterMergeMap, pandora::PfoSet &unchangedPfos) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
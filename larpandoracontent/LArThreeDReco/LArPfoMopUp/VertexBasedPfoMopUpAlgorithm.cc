@@ -57,21 +57,26 @@ StatusCode VertexBasedPfoMopUpAlgorithm::Run()
         return STATUS_CODE_SUCCESS;
     }
 
+    PfoSet unchangedPfos;
+    this->GetUnchangedPfos(unchangedPfos);
+
     while (true)
     {
         PfoList vertexPfos, nonVertexPfos;
         this->GetInputPfos(pSelectedVertex, vertexPfos, nonVertexPfos);
 
         PfoAssociationList pfoAssociationList;
-        this->GetPfoAssociations(pSelectedVertex, vertexPfos, nonVertexPfos, pfoAssociationList);
+        this->GetPfoAssociations(pSelectedVertex, vertexPfos, nonVertexPfos, unchangedPfos, pfoAssociationList);
 
         std::sort(pfoAssociationList.begin(), pfoAssociationList.end());
-        const bool pfoMergeMade(this->ProcessPfoAssociations(pfoAssociationList));
+        const bool pfoMergeMade(this->ProcessPfoAssociations(pfoAssociationList, unchangedPfos));
 
         if (!pfoMergeMade)
             break;
     }
 
+    this->RecordEventState(true);
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -152,12 +157,18 @@ bool VertexBasedPfoMopUpAlgorithm::IsVertexAssociated(const Pfo *const pPfo, con
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void VertexBasedPfoMopUpAlgorithm::GetPfoAssociations(const Vertex *const pVertex, const PfoList &vertexPfos, const PfoList &nonVertexPfos,
-    PfoAssociationList &pfoAssociationList) const
+    const PfoSet &unchangedPfos, PfoAssociationList &pfoAssociationList) const
 {
     for (const Pfo *const pVertexPfo : vertexPfos)
     {
+        const bool isVertexPfoUnchanged(unchangedPfos.count(pVertexPfo) > 0);
+
         for (const Pfo *const pDaughterPfo : nonVertexPfos)
         {
+            // ATTN Unchanged pfos failed the merge criteria when this algorithm last ran, so only pairs including a changed pfo can now pass
+            if (isVertexPfoUnchanged && unchangedPfos.count(pDaughterPfo))
+                continue;
+
             try
             {
                 const PfoAssociation pfoAssociation(this->GetPfoAssociation(pVertex, pVertexPfo, pDaughterPfo));
@@ -219,7 +230,7 @@ VertexBasedPfoMopUpAlgorithm::ClusterAssociation VertexBasedPfoMopUpAlgorithm::G
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool VertexBasedPfoMopUpAlgorithm::ProcessPfoAssociations(const PfoAssociationList &pfoAssociationList) const
+bool VertexBasedPfoMopUpAlgorithm::ProcessPfoAssociations(const PfoAssociationList &pfoAssociationList, PfoSet &unchangedPfos) const
 {
     const PfoList *pTrackPfoList(nullptr);
     (void) PandoraContentApi::GetList(*this, m_trackPfoListName, pTrackPfoList);
@@ -250,6 +261,8 @@ bool VertexBasedPfoMopUpAlgorithm::ProcessPfoAssociations(const PfoAssociationLi
             }
         }
 
+        (void) unchangedPfos.erase(pfoAssociation.GetVertexPfo());
+        (void) unchangedPfos.erase(pfoAssociation.GetDaughterPfo());
         this->MergePfos(pfoAssociation);
         return true;
     }
@@ -294,10 +294,11 @@ protected:
      *  @param  pVertex the address of the 3d vertex
      *  @param  vertexPfos the list of vertex-associated pfos
      *  @param  nonVertexPfos the list of nonvertex-associated pfos
+     *  @param  unchangedPfos the pfos unchanged since the last run, pairs of which need not be considered
      *  @param  pfoAssociationList to receive the pfo association list
      */
     void GetPfoAssociations(const pandora::Vertex *const pVertex, const pandora::PfoList &vertexPfos, const pandora::PfoList &nonVertexPfos,
-        PfoAssociationList &pfoAssociationList) const;
+        const pandora::PfoSet &unchangedPfos, PfoAssociationList &pfoAssociationList) const;
 
     /**
      *  @brief  Get pfo association details between a vertex-associated pfo and a non-vertex associated daughter candidate pfo
@@ -326,10 +327,11 @@ protected:
      *  @brief  Process the list of pfo associations, merging the best-matching pfo
      *
      *  @param  pfoAssociationList the pfo association list
+     *  @param  unchangedPfos the pfos unchanged since the last run, from which the merged pfos are removed
      *
      *  @return whether a pfo merge was made
      */
-    bool ProcessPfoAssociations(const PfoAssociationList &pfoAssociationList) const;
+    bool ProcessPfoAssociations(const PfoAssociationList &pfoAssociationList, pandora::PfoSet &unchangedPfos) const;
 
     /**
      *  @brief  Merge the vertex and daughter pfos (deleting daughter pfo, merging clusters, etc.) described in the specified pfoAssociation
@@ -103,6 +103,7 @@ private:
     void RemoveFromSlidingFitCache(const pandora::Cluster *const pCluster);
 
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+    bool IsOverlapCalculationThreadSafe() const;
 
     /**
      *  @brief  Calculate the overlap result for given group of clusters
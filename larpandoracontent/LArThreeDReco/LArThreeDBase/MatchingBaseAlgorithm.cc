@@ -29,6 +29,13 @@ MatchingBaseAlgorithm::~MatchingBaseAlgorithm()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool MatchingBaseAlgorithm::IsOverlapCalculationThreadSafe() const
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void MatchingBaseAlgorithm::SelectInputClusters(const ClusterList *const pInputClusterList, ClusterList &selectedClusterList) const
 {
     if (!pInputClusterList)
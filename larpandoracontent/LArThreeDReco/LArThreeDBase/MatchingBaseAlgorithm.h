@@ -98,6 +98,14 @@ public:
      */
     virtual void CalculateOverlapResult(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, const pandora::Cluster *const pCluster3 = nullptr) = 0;
 
+    /**
+     *  @brief  Whether CalculateOverlapResult may be called concurrently for different cluster combinations. This requires that it reads
+     *          only inputs which are not modified during the main loop and that it stores only the result for the specified clusters.
+     *
+     *  @return boolean
+     */
+    virtual bool IsOverlapCalculationThreadSafe() const;
+
     /**
      *  @brief  Select a subset of input clusters for processing in this algorithm
      *
@@ -44,12 +44,12 @@ NViewTrackMatchingAlgorithm<T>::~NViewTrackMatchingAlgorithm()
 template<typename T>
 const TwoDSlidingFitResult &NViewTrackMatchingAlgorithm<T>::GetCachedSlidingFitResult(const Cluster *const pCluster) const
 {
-    TwoDSlidingFitResultMap::const_iterator iter = m_slidingFitResultMap.find(pCluster);
+    TwoDSlidingFitResultPtrMap::const_iterator iter = m_slidingFitResultMap.find(pCluster);
 
     if (m_slidingFitResultMap.end() == iter)
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    return iter->second;
+    return *(iter->second);
 }
 
 
@@ -252,9 +252,9 @@ template<typename T>
 void NViewTrackMatchingAlgorithm<T>::AddToSlidingFitCache(const Cluster *const pCluster)
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-    const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitWindow, slidingFitPitch);
+    const TwoDSlidingFitResultPtr spSlidingFitResult(SlidingFitCache::GetSlidingFitResult(*this, pCluster, m_slidingFitWindow, slidingFitPitch));
 
-    if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult)).second)
+    if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultPtrMap::value_type(pCluster, spSlidingFitResult)).second)
         throw StatusCodeException(STATUS_CODE_FAILURE);
 }
 
@@ -263,7 +263,7 @@ void NViewTrackMatchingAlgorithm<T>::AddToSlidingFitCache(const Cluster *const p
 template<typename T>
 void NViewTrackMatchingAlgorithm<T>::RemoveFromSlidingFitCache(const Cluster *const pCluster)
 {
-    TwoDSlidingFitResultMap::iterator iter = m_slidingFitResultMap.find(pCluster);
+    TwoDSlidingFitResultPtrMap::iterator iter = m_slidingFitResultMap.find(pCluster);
 
     if (m_slidingFitResultMap.end() != iter)
         m_slidingFitResultMap.erase(iter);
@@ -280,6 +280,16 @@ void NViewTrackMatchingAlgorithm<T>::TidyUp()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template<typename T>
+StatusCode NViewTrackMatchingAlgorithm<T>::Reset()
+{
+    SlidingFitCache::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template<typename T>
 StatusCode NViewTrackMatchingAlgorithm<T>::ReadSettings(const TiXmlHandle xmlHandle)
 {
@@ -8,6 +8,7 @@
 #ifndef LAR_N_VIEW_TRACK_MATCHING_ALGORITHM_H
 #define LAR_N_VIEW_TRACK_MATCHING_ALGORITHM_H 1
 
+#include "larpandoracontent/LArObjects/LArSlidingFitCache.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewMatchingAlgorithm.h"
@@ -88,7 +89,7 @@ public:
 
 protected:
     /**
-     *  @brief  Add a new sliding fit result, for the specified cluster, to the algorithm cache
+     *  @brief  Add a sliding fit result, for the specified cluster, to the algorithm cache, reusing any unchanged fit in the event cache
      *
      *  @param  pCluster address of the relevant cluster
      */
@@ -102,11 +103,12 @@ protected:
     void RemoveFromSlidingFitCache(const pandora::Cluster *const pCluster);
 
     virtual void TidyUp();
+    virtual pandora::StatusCode Reset();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
 private:
     unsigned int                m_slidingFitWindow;             ///< The layer window for the sliding linear fits
-    TwoDSlidingFitResultMap     m_slidingFitResultMap;          ///< The sliding fit result map
+    TwoDSlidingFitResultPtrMap  m_slidingFitResultMap;          ///< The sliding fit result map
 
     unsigned int                m_minClusterCaloHits;           ///< The min number of hits in base cluster selection method
     float                       m_minClusterLengthSquared;      ///< The min length (squared) in base cluster selection method
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include "larpandoracontent/LArObjects/LArShowerOverlapResult.h"
 #include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
@@ -16,6 +17,8 @@
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/MatchingBaseAlgorithm.h"
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/ThreeViewMatchingControl.h"
 
+#include <exception>
+
 using namespace pandora;
 
 namespace lar_content
@@ -26,7 +29,11 @@ ThreeViewMatchingControl<T>::ThreeViewMatchingControl(MatchingBaseAlgorithm *con
     NViewMatchingControl(pAlgorithm),
     m_pInputClusterListU(nullptr),
     m_pInputClusterListV(nullptr),
-    m_pInputClusterListW(nullptr)
+    m_pInputClusterListW(nullptr),
+    m_nThreads(1),
+    m_incrementalToolIteration(false),
+    m_nToolInvocations(0),
+    m_nToolElementsExamined(0)
 {
 }
 
@@ -42,7 +49,8 @@ ThreeViewMatchingControl<T>::~ThreeViewMatchingControl()
 template <typename T>
 typename ThreeViewMatchingControl<T>::TensorType &ThreeViewMatchingControl<T>::GetOverlapTensor()
 {
-    return m_overlapTensor;
+    TensorType *const pScratchTensor(ThreeViewMatchingControl<T>::GetScratchOverlapTensor());
+    return (pScratchTensor ? *pScratchTensor : m_overlapTensor);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -70,23 +78,19 @@ void ThreeViewMatchingControl<T>::UpdateForNewCluster(const Cluster *const pNewC
     std::sort(clusterVector2.begin(), clusterVector2.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVector3.begin(), clusterVector3.end(), LArClusterHelper::SortByNHits);
 
-    for (const Cluster *const pCluster2 : clusterVector2)
+    const ClusterVector newClusterVector(1, pNewCluster);
+
+    if (TPC_VIEW_U == hitType)
     {
-        for (const Cluster *const pCluster3 : clusterVector3)
-        {
-            if (TPC_VIEW_U == hitType)
-            {
-                m_pAlgorithm->CalculateOverlapResult(pNewCluster, pCluster2, pCluster3);
-            }
-            else if (TPC_VIEW_V == hitType)
-            {
-                m_pAlgorithm->CalculateOverlapResult(pCluster2, pNewCluster, pCluster3);
-            }
-            else
-            {
-                m_pAlgorithm->CalculateOverlapResult(pCluster2, pCluster3, pNewCluster);
-            }
-        }
+        this->CalculateOverlapResults(newClusterVector, clusterVector2, clusterVector3);
+    }
+    else if (TPC_VIEW_V == hitType)
+    {
+        this->CalculateOverlapResults(clusterVector2, newClusterVector, clusterVector3);
+    }
+    else
+    {
+        this->CalculateOverlapResults(clusterVector2, clusterVector3, newClusterVector);
     }
 }
 
@@ -225,24 +229,138 @@ void ThreeViewMatchingControl<T>::PerformMainLoop()
     std::sort(clusterVectorV.begin(), clusterVectorV.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVectorW.begin(), clusterVectorW.end(), LArClusterHelper::SortByNHits);
 
-    for (const Cluster *const pClusterU : clusterVectorU)
+    this->CalculateOverlapResults(clusterVectorU, clusterVectorV, clusterVectorW);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ThreeViewMatchingControl<T>::CalculateOverlapResults(const ClusterVector &clusterVectorU, const ClusterVector &clusterVectorV,
+    const ClusterVector &clusterVectorW)
+{
+    if (m_nThreads < 2)
     {
-        for (const Cluster *const pClusterV : clusterVectorV)
+        for (const Cluster *const pClusterU : clusterVectorU)
+        {
+            for (const Cluster *const pClusterV : clusterVectorV)
+            {
+                for (const Cluster *const pClusterW : clusterVectorW)
+                    m_pAlgorithm->CalculateOverlapResult(pClusterU, pClusterV, pClusterW);
+            }
+        }
+
+        return;
+    }
+
+    // ATTN Each task handles one (u, v) pair and collects the results for its w clusters, stopping at the first exception, as a serial loop would
+    const std::size_t nTasks(clusterVectorU.size() * clusterVectorV.size());
+    std::vector<ClusterOverlapResultList> taskResults(nTasks);
+    std::vector<std::exception_ptr> taskExceptions(nTasks);
+
+    LArParallelHelper::ForEach(nTasks, m_nThreads, [&](const std::size_t iTask) {
+        const Cluster *const pClusterU(clusterVectorU.at(iTask / clusterVectorV.size()));
+        const Cluster *const pClusterV(clusterVectorV.at(iTask % clusterVectorV.size()));
+
+        TensorType scratchTensor;
+        TensorType *&pScratchTensor(ThreeViewMatchingControl<T>::GetScratchOverlapTensor());
+        pScratchTensor = &scratchTensor;
+
+        try
         {
             for (const Cluster *const pClusterW : clusterVectorW)
+            {
                 m_pAlgorithm->CalculateOverlapResult(pClusterU, pClusterV, pClusterW);
+
+                if (scratchTensor.begin() != scratchTensor.end())
+                {
+                    taskResults.at(iTask).emplace_back(pClusterW, scratchTensor.GetOverlapResult(pClusterU, pClusterV, pClusterW));
+                    scratchTensor.Clear();
+                }
+            }
+        }
+        catch (...)
+        {
+            taskExceptions.at(iTask) = std::current_exception();
+        }
+
+        pScratchTensor = nullptr;
+    });
+
+    for (std::size_t iTask = 0; iTask < nTasks; ++iTask)
+    {
+        const Cluster *const pClusterU(clusterVectorU.at(iTask / clusterVectorV.size()));
+        const Cluster *const pClusterV(clusterVectorV.at(iTask % clusterVectorV.size()));
+
+        for (const typename ClusterOverlapResultList::value_type &resultEntry : taskResults.at(iTask))
+            m_overlapTensor.SetOverlapResult(pClusterU, pClusterV, resultEntry.first, resultEntry.second);
+
+        if (taskExceptions.at(iTask))
+            std::rethrow_exception(taskExceptions.at(iTask));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ThreeViewMatchingControl<T>::RecordAvailabilityChanges(ClusterAvailabilityMap &availabilityMap)
+{
+    for (const typename TensorType::ClusterNavigationMap *const pNavigationMap : {&m_overlapTensor.GetClusterNavigationMapUV(),
+        &m_overlapTensor.GetClusterNavigationMapVW(), &m_overlapTensor.GetClusterNavigationMapWU()})
+    {
+        for (const typename TensorType::ClusterNavigationMap::value_type &mapEntry : *pNavigationMap)
+        {
+            const Cluster *const pCluster(mapEntry.first);
+            const bool isAvailable(pCluster->IsAvailable());
+            const std::pair<typename ClusterAvailabilityMap::iterator, bool> insertResult(availabilityMap.insert(
+                typename ClusterAvailabilityMap::value_type(pCluster, isAvailable)));
+
+            if (!insertResult.second && (insertResult.first->second != isAvailable))
+            {
+                insertResult.first->second = isAvailable;
+                m_overlapTensor.RecordChange(pCluster);
+            }
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void ThreeViewMatchingControl<T>::PrintToolCounters() const
+{
+    if (PandoraContentApi::GetSettings(*m_pAlgorithm)->ShouldDisplayAlgorithmInfo())
+    {
+        std::cout << "ThreeViewMatchingControl: " << m_pAlgorithm->GetType() << ", tool invocations " << m_nToolInvocations
+                  << ", elements examined " << m_nToolElementsExamined << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+typename ThreeViewMatchingControl<T>::TensorType *&ThreeViewMatchingControl<T>::GetScratchOverlapTensor()
+{
+    thread_local TensorType *pScratchTensor(nullptr);
+    return pScratchTensor;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 StatusCode ThreeViewMatchingControl<T>::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameU", m_inputClusterListNameU));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameV", m_inputClusterListNameV));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameW", m_inputClusterListNameW));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NThreads", m_nThreads));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "IncrementalToolIteration", m_incrementalToolIteration));
+
+    if ((m_nThreads > 1) && !m_pAlgorithm->IsOverlapCalculationThreadSafe())
+    {
+        std::cout << "ThreeViewMatchingControl: overlap calculation for " << m_pAlgorithm->GetType() << " does not support NThreads > 1" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
 
     return STATUS_CODE_SUCCESS;
 }
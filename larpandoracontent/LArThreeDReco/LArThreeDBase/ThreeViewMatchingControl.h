@@ -12,6 +12,11 @@
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewMatchingControl.h"
 
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -43,7 +48,48 @@ public:
      */
     TensorType &GetOverlapTensor();
 
+    /**
+     *  @brief  Run a list of tensor tools in order, returning to the first tool whenever a tool reports a change. If incremental tool
+     *          iteration is enabled, a tool that previously reported no change only sees the key clusters in connected regions of the
+     *          tensor that have changed since it last ran. This assumes that each tool treats connected regions independently.
+     *
+     *  @param  pAlgorithm address of the algorithm, passed to the tools
+     *  @param  toolVector the tensor tools
+     *  @param  nMaxRepeats the maximum number of returns to the first tool
+     */
+    template <typename TALGORITHM, typename TTOOL>
+    void RunTensorTools(TALGORITHM *const pAlgorithm, const std::vector<TTOOL*> &toolVector, const unsigned int nMaxRepeats);
+
+    /**
+     *  @brief  Get the number of tensor tool invocations in the last call to RunTensorTools
+     *
+     *  @return the number of tool invocations
+     */
+    unsigned int GetNToolInvocations() const;
+
+    /**
+     *  @brief  Get the number of tensor elements visited by the tools via GetConnectedElements and GetUnambiguousElements, summed over
+     *          the tool invocations in the last call to RunTensorTools
+     *
+     *  @return the number of elements examined
+     */
+    unsigned int GetNToolElementsExamined() const;
+
 private:
+    typedef std::unordered_map<const pandora::Cluster*, bool> ClusterAvailabilityMap;
+
+    /**
+     *  @brief  Record, in the overlap tensor, a change for each tensor cluster whose availability differs from that in a map
+     *
+     *  @param  availabilityMap the map from cluster to its last known availability, to be updated
+     */
+    void RecordAvailabilityChanges(ClusterAvailabilityMap &availabilityMap);
+
+    /**
+     *  @brief  Print the tensor tool counters, if the pandora settings request display of algorithm information
+     */
+    void PrintToolCounters() const;
+
     void UpdateForNewCluster(const pandora::Cluster *const pNewCluster);
     void UpdateUponDeletion(const pandora::Cluster *const pDeletedCluster);
     const std::string &GetClusterListName(const pandora::HitType hitType) const;
@@ -55,6 +101,27 @@ private:
     void TidyUp();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    typedef std::vector<std::pair<const pandora::Cluster*, T>> ClusterOverlapResultList;
+
+    /**
+     *  @brief  Calculate the overlap results for all combinations of clusters from three vectors, looping over u, then v, then w clusters.
+     *          If configured to use several threads, the combinations are shared between threads and the results are then added to the
+     *          overlap tensor in the serial loop order, so that the tensor contents do not depend on the number of threads.
+     *
+     *  @param  clusterVectorU the u clusters
+     *  @param  clusterVectorV the v clusters
+     *  @param  clusterVectorW the w clusters
+     */
+    void CalculateOverlapResults(const pandora::ClusterVector &clusterVectorU, const pandora::ClusterVector &clusterVectorV,
+        const pandora::ClusterVector &clusterVectorW);
+
+    /**
+     *  @brief  Get the address of the scratch overlap tensor used by the current thread during concurrent overlap calculations
+     *
+     *  @return the address of the scratch tensor, or nullptr if the current thread is not calculating overlap results concurrently
+     */
+    static TensorType *&GetScratchOverlapTensor();
+
     const pandora::ClusterList *m_pInputClusterListU;           ///< Address of the input cluster list U
     const pandora::ClusterList *m_pInputClusterListV;           ///< Address of the input cluster list V
     const pandora::ClusterList *m_pInputClusterListW;           ///< Address of the input cluster list W
@@ -69,12 +136,102 @@ private:
     std::string                 m_inputClusterListNameV;        ///< The name of the view V cluster list
     std::string                 m_inputClusterListNameW;        ///< The name of the view W cluster list
 
+    unsigned int                m_nThreads;                     ///< The maximum number of threads used to calculate overlap results
+    bool                        m_incrementalToolIteration;     ///< Whether tools that reported no change only revisit changed regions
+    unsigned int                m_nToolInvocations;             ///< The number of tensor tool invocations in the last tool iteration
+    unsigned int                m_nToolElementsExamined;        ///< The number of tensor elements examined in the last tool iteration
+
     friend class ThreeViewTrackFragmentsAlgorithm;              ///< ATTN This is for legacy purposes only
 
     template <typename U>
     friend class NViewMatchingAlgorithm;
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+template <typename TALGORITHM, typename TTOOL>
+void ThreeViewMatchingControl<T>::RunTensorTools(TALGORITHM *const pAlgorithm, const std::vector<TTOOL*> &toolVector, const unsigned int nMaxRepeats)
+{
+    // ATTN For each tool, the recorded change marker when it last reported no change, or none if it has not yet run or reported a change
+    const std::size_t noMarker(std::numeric_limits<std::size_t>::max());
+    std::vector<std::size_t> changeMarkers(toolVector.size(), noMarker);
+    ClusterAvailabilityMap availabilityMap;
+
+    m_nToolInvocations = 0;
+    m_nToolElementsExamined = 0;
+
+    // ATTN Tensor changes are only needed, and so only recorded, while tools are run incrementally
+    m_overlapTensor.SetRecordChanges(m_incrementalToolIteration);
+
+    unsigned int repeatCounter(0);
+
+    for (std::size_t iTool = 0; iTool < toolVector.size(); )
+    {
+        if (m_incrementalToolIteration)
+        {
+            this->RecordAvailabilityChanges(availabilityMap);
+
+            if (noMarker != changeMarkers.at(iTool))
+                m_overlapTensor.RestrictToChangesSince(changeMarkers.at(iTool));
+        }
+
+        const std::size_t changeMarker(m_overlapTensor.GetNRecordedChanges());
+        const unsigned int nElementsVisited(m_overlapTensor.GetNElementsVisited());
+        ++m_nToolInvocations;
+
+        bool changesMade(false);
+
+        try
+        {
+            changesMade = toolVector.at(iTool)->Run(pAlgorithm, m_overlapTensor);
+        }
+        catch (...)
+        {
+            m_nToolElementsExamined += m_overlapTensor.GetNElementsVisited() - nElementsVisited;
+            m_overlapTensor.RemoveRestriction();
+            m_overlapTensor.SetRecordChanges(false);
+            throw;
+        }
+
+        m_nToolElementsExamined += m_overlapTensor.GetNElementsVisited() - nElementsVisited;
+        m_overlapTensor.RemoveRestriction();
+
+        if (changesMade)
+        {
+            changeMarkers.at(iTool) = noMarker;
+            iTool = 0;
+
+            if (++repeatCounter > nMaxRepeats)
+                break;
+        }
+        else
+        {
+            changeMarkers.at(iTool) = changeMarker;
+            ++iTool;
+        }
+    }
+
+    m_overlapTensor.SetRecordChanges(false);
+    this->PrintToolCounters();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline unsigned int ThreeViewMatchingControl<T>::GetNToolInvocations() const
+{
+    return m_nToolInvocations;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline unsigned int ThreeViewMatchingControl<T>::GetNToolElementsExamined() const
+{
+    return m_nToolElementsExamined;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_THREE_VIEW_MATCHING_CONTROL_H
@@ -9,12 +9,15 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include "larpandoracontent/LArObjects/LArTrackTwoViewOverlapResult.h"
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/MatchingBaseAlgorithm.h"
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/TwoViewMatchingControl.h"
 
+#include <exception>
+
 using namespace pandora;
 
 namespace lar_content
@@ -24,7 +27,8 @@ template <typename T>
 TwoViewMatchingControl<T>::TwoViewMatchingControl(MatchingBaseAlgorithm *const pAlgorithm) :
     NViewMatchingControl(pAlgorithm),
     m_pInputClusterList1(nullptr),
-    m_pInputClusterList2(nullptr)
+    m_pInputClusterList2(nullptr),
+    m_nThreads(1)
 {
 }
 
@@ -40,7 +44,8 @@ TwoViewMatchingControl<T>::~TwoViewMatchingControl()
 template <typename T>
 typename TwoViewMatchingControl<T>::MatrixType &TwoViewMatchingControl<T>::GetOverlapMatrix()
 {
-    return m_overlapMatrix;
+    MatrixType *const pScratchMatrix(TwoViewMatchingControl<T>::GetScratchOverlapMatrix());
+    return (pScratchMatrix ? *pScratchMatrix : m_overlapMatrix);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -66,16 +71,15 @@ void TwoViewMatchingControl<T>::UpdateForNewCluster(const Cluster *const pNewClu
     ClusterVector clusterVector2(clusterList2.begin(), clusterList2.end());
     std::sort(clusterVector2.begin(), clusterVector2.end(), LArClusterHelper::SortByNHits);
 
-    for (const Cluster *const pCluster2 : clusterVector2)
+    const ClusterVector newClusterVector(1, pNewCluster);
+
+    if (1 == iter->second)
     {
-        if (1 == iter->second)
-        {
-            m_pAlgorithm->CalculateOverlapResult(pNewCluster, pCluster2);
-        }
-        else
-        {
-            m_pAlgorithm->CalculateOverlapResult(pCluster2, pNewCluster);
-        }
+        this->CalculateOverlapResults(newClusterVector, clusterVector2);
+    }
+    else
+    {
+        this->CalculateOverlapResults(clusterVector2, newClusterVector);
     }
 }
 
@@ -206,11 +210,83 @@ void TwoViewMatchingControl<T>::PerformMainLoop()
     std::sort(clusterVector1.begin(), clusterVector1.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVector2.begin(), clusterVector2.end(), LArClusterHelper::SortByNHits);
 
-    for (const Cluster *const pCluster1 : clusterVector1)
+    this->CalculateOverlapResults(clusterVector1, clusterVector2);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void TwoViewMatchingControl<T>::CalculateOverlapResults(const ClusterVector &clusterVector1, const ClusterVector &clusterVector2)
+{
+    // ATTN A single view 1 cluster, as for a new cluster, gives a single task, so share the view 2 clusters between tasks instead
+    const bool splitByCluster1(clusterVector1.size() > 1);
+    const std::size_t nTasks(splitByCluster1 ? clusterVector1.size() : clusterVector2.size());
+
+    if ((m_nThreads < 2) || (nTasks < 2))
     {
-        for (const Cluster *const pCluster2 : clusterVector2)
-            m_pAlgorithm->CalculateOverlapResult(pCluster1, pCluster2);
+        for (const Cluster *const pCluster1 : clusterVector1)
+        {
+            for (const Cluster *const pCluster2 : clusterVector2)
+                m_pAlgorithm->CalculateOverlapResult(pCluster1, pCluster2);
+        }
+
+        return;
     }
+
+    std::vector<ClusterOverlapResultList> taskResults(nTasks);
+    std::vector<std::exception_ptr> taskExceptions(nTasks);
+
+    LArParallelHelper::ForEach(nTasks, m_nThreads, [&](const std::size_t iTask) {
+        MatrixType scratchMatrix;
+        MatrixType *&pScratchMatrix(TwoViewMatchingControl<T>::GetScratchOverlapMatrix());
+        pScratchMatrix = &scratchMatrix;
+
+        try
+        {
+            const ClusterVector &innerClusterVector(splitByCluster1 ? clusterVector2 : clusterVector1);
+
+            for (const Cluster *const pInnerCluster : innerClusterVector)
+            {
+                const Cluster *const pCluster1(splitByCluster1 ? clusterVector1.at(iTask) : pInnerCluster);
+                const Cluster *const pCluster2(splitByCluster1 ? pInnerCluster : clusterVector2.at(iTask));
+                m_pAlgorithm->CalculateOverlapResult(pCluster1, pCluster2);
+
+                if (scratchMatrix.begin() != scratchMatrix.end())
+                {
+                    taskResults.at(iTask).emplace_back(pInnerCluster, scratchMatrix.GetOverlapResult(pCluster1, pCluster2));
+                    scratchMatrix.Clear();
+                }
+            }
+        }
+        catch (...)
+        {
+            taskExceptions.at(iTask) = std::current_exception();
+        }
+
+        pScratchMatrix = nullptr;
+    });
+
+    for (std::size_t iTask = 0; iTask < nTasks; ++iTask)
+    {
+        for (const typename ClusterOverlapResultList::value_type &resultEntry : taskResults.at(iTask))
+        {
+            const Cluster *const pCluster1(splitByCluster1 ? clusterVector1.at(iTask) : resultEntry.first);
+            const Cluster *const pCluster2(splitByCluster1 ? resultEntry.first : clusterVector2.at(iTask));
+            m_overlapMatrix.SetOverlapResult(pCluster1, pCluster2, resultEntry.second);
+        }
+
+        if (taskExceptions.at(iTask))
+            std::rethrow_exception(taskExceptions.at(iTask));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+typename TwoViewMatchingControl<T>::MatrixType *&TwoViewMatchingControl<T>::GetScratchOverlapMatrix()
+{
+    thread_local MatrixType *pScratchMatrix(nullptr);
+    return pScratchMatrix;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -220,6 +296,13 @@ StatusCode TwoViewMatchingControl<T>::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListName1", m_inputClusterListName1));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListName2", m_inputClusterListName2));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NThreads", m_nThreads));
+
+    if ((m_nThreads > 1) && !m_pAlgorithm->IsOverlapCalculationThreadSafe())
+    {
+        std::cout << "TwoViewMatchingControl: overlap calculation for " << m_pAlgorithm->GetType() << " does not support NThreads > 1" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
 
     return STATUS_CODE_SUCCESS;
 }
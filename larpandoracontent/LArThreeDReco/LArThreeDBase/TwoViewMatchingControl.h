@@ -13,6 +13,8 @@
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewMatchingControl.h"
 
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace lar_content
 {
@@ -57,6 +59,25 @@ private:
     void TidyUp();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    typedef std::vector<std::pair<const pandora::Cluster*, T>> ClusterOverlapResultList;
+
+    /**
+     *  @brief  Calculate the overlap results for all combinations of clusters from two vectors, looping over view 1, then view 2 clusters.
+     *          If configured to use several threads, the combinations are shared between threads and the results are then added to the
+     *          overlap matrix in the serial loop order, so that the matrix contents do not depend on the number of threads.
+     *
+     *  @param  clusterVector1 the view 1 clusters
+     *  @param  clusterVector2 the view 2 clusters
+     */
+    void CalculateOverlapResults(const pandora::ClusterVector &clusterVector1, const pandora::ClusterVector &clusterVector2);
+
+    /**
+     *  @brief  Get the address of the scratch overlap matrix used by the current thread during concurrent overlap calculations
+     *
+     *  @return the address of the scratch matrix, or nullptr if the current thread is not calculating overlap results concurrently
+     */
+    static MatrixType *&GetScratchOverlapMatrix();
+
     const pandora::ClusterList *m_pInputClusterList1;           ///< Address of the input cluster list 1
     const pandora::ClusterList *m_pInputClusterList2;           ///< Address of the input cluster list 2
 
@@ -71,6 +92,8 @@ private:
     std::string                 m_inputClusterListName1;        ///< The name of the view 1 cluster list
     std::string                 m_inputClusterListName2;        ///< The name of the view 2 cluster list
 
+    unsigned int                m_nThreads;                     ///< The maximum number of threads used to calculate overlap results
+
     template <typename U>
     friend class NViewMatchingAlgorithm;
 };
@@ -42,6 +42,7 @@ private:
     typedef std::map<unsigned int, FitSegmentMatrix> FitSegmentTensor;
 
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+    bool IsOverlapCalculationThreadSafe() const;
 
     /**
      *  @brief  Calculate the overlap result for given group of clusters
@@ -36,12 +36,26 @@ MvaPfoCharacterisationAlgorithm<T>::MvaPfoCharacterisationAlgorithm() :
     m_fiducialMinZ(-std::numeric_limits<float>::max()),
     m_fiducialMaxZ(std::numeric_limits<float>::max()),
     m_applyReconstructabilityChecks(false),
+    m_trainingOutputFormat(LArMvaHelper::TEXT_OUTPUT),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH")
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template<typename T>
+StatusCode MvaPfoCharacterisationAlgorithm<T>::Run()
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PfoCharacterisationBaseAlgorithm::Run());
+
+    if (m_trainingSetMode)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMvaHelper::FlushTrainingExamples());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template<typename T>
 bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const Cluster *const pCluster) const
 {
@@ -61,7 +75,7 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const Cluster *const pClus
         }
         catch (const StatusCodeException &) {}
 
-        LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, isTrueTrack, featureVector);
+        LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, m_trainingOutputFormat, isTrueTrack, featureVector);
         return isTrueTrack;
     }
 
@@ -204,7 +218,7 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
                 std::string outputFile(m_trainingOutputFile);
                 const std::string end=((wClusterList.empty()) ? "noChargeInfo.txt" : ".txt");
                 outputFile.append(end);
-                LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, featureVector);
+                LArMvaHelper::ProduceTrainingExample(outputFile, m_trainingOutputFormat, isTrueTrack, featureVector);
             }
         }
 
@@ -227,7 +241,7 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
         {
             std::string outputFile(m_trainingOutputFile);
             outputFile.append(wClusterList.empty() ? "noChargeInfo.txt" : ".txt");
-            LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, featureVector);
+            LArMvaHelper::ProduceTrainingExample(outputFile, m_trainingOutputFormat, isTrueTrack, featureVector);
         }
 
         return isTrueTrack;
@@ -331,6 +345,11 @@ StatusCode MvaPfoCharacterisationAlgorithm<T>::ReadSettings(const TiXmlHandle xm
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListName", m_caloHitListName));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "MCParticleListName", m_mcParticleListName));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFileName", m_trainingOutputFile));
+
+        bool writeBinaryTrainingExamples(false);
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "WriteBinaryTrainingExamples", writeBinaryTrainingExamples));
+        m_trainingOutputFormat = (writeBinaryTrainingExamples ? LArMvaHelper::TEXT_AND_BINARY_OUTPUT : LArMvaHelper::TEXT_OUTPUT);
+
         PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TestBeamMode", m_testBeamMode));
         PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ApplyFiducialCut", m_applyFiducialCut));
         if (m_applyFiducialCut)
@@ -32,6 +32,7 @@ public:
     MvaPfoCharacterisationAlgorithm();
 
 protected:
+    pandora::StatusCode Run();
     virtual bool IsClearTrack(const pandora::ParticleFlowObject *const pPfo) const;
     virtual bool IsClearTrack(const pandora::Cluster *const pCluster) const;
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -62,6 +63,7 @@ protected:
     std::string             m_mcParticleListName;           ///< Name of input MC particle list
 
     std::string             m_trainingOutputFile;           ///< The training output file
+    LArMvaHelper::TrainingOutputFormat m_trainingOutputFormat; ///< The training output format
     std::string             m_filePathEnvironmentVariable;  ///< The environment variable providing a list of paths to mva files
     std::string             m_mvaFileName;                  ///< The mva input file
     std::string             m_mvaName;                      ///< The name of the mva to find
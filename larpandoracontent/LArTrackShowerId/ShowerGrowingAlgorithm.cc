@@ -47,6 +47,25 @@ bool ShowerGrowingAlgorithm::IsVertexAssociated(const LArPointingCluster &pointi
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ShowerGrowingAlgorithm::GetVertexAssociations(const LArPointingClusterList &pointingClusterList, const CartesianVector &vertexPosition2D,
+    LArPointingClusterArrays::FlagVector &isVertexAssociated) const
+{
+    m_pointingClusterArrays.Fill(pointingClusterList);
+    isVertexAssociated.assign(m_pointingClusterArrays.GetSize(), 0);
+
+    // ATTN The impact parameters of each vertex are calculated once, then used for both the node and emission checks
+    for (const LArPointingClusterArrays::VertexArrays *const pVertexArrays : {&m_pointingClusterArrays.GetInnerVertices(), &m_pointingClusterArrays.GetOuterVertices()})
+    {
+        LArPointingClusterHelper::GetImpactParameters(*pVertexArrays, vertexPosition2D, m_longitudinalDisplacements, m_transverseDisplacements);
+        LArPointingClusterHelper::IsNode(m_longitudinalDisplacements, m_transverseDisplacements, m_minVertexLongitudinalDistance,
+            m_maxVertexTransverseDistance, isVertexAssociated);
+        LArPointingClusterHelper::IsEmission(m_longitudinalDisplacements, m_transverseDisplacements, m_minVertexLongitudinalDistance,
+            m_maxVertexLongitudinalDistance, m_maxVertexTransverseDistance, m_vertexAngularAllowance, isVertexAssociated);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool ShowerGrowingAlgorithm::SortClusters(const Cluster *const pLhs, const Cluster *const pRhs)
 {
     CartesianVector innerCoordinateLhs(0.f, 0.f, 0.f), outerCoordinateLhs(0.f, 0.f, 0.f);
@@ -80,11 +99,11 @@ StatusCode ShowerGrowingAlgorithm::Run()
             }
 
             this->SimpleModeShowerGrowing(pClusterList, clusterListName);
-            m_clusterDirectionMap.clear();
+            this->ClearCachedProperties();
         }
         catch (StatusCodeException &statusCodeException)
         {
-            m_clusterDirectionMap.clear();
+            this->ClearCachedProperties();
             throw statusCodeException;
         }
     }
@@ -94,6 +113,56 @@ StatusCode ShowerGrowingAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ShowerGrowingAlgorithm::SortClusterVector(ClusterVector &clusterVector) const
+{
+    for (const Cluster *const pCluster : clusterVector)
+        (void) this->GetExtremalLengthSquared(pCluster);
+
+    // ATTN Same comparisons as SortClusters, so the same order results
+    std::sort(clusterVector.begin(), clusterVector.end(), [this](const Cluster *const pLhs, const Cluster *const pRhs)
+        {return (m_clusterLengthSquaredMap.at(pLhs) > m_clusterLengthSquaredMap.at(pRhs));});
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float ShowerGrowingAlgorithm::GetExtremalLengthSquared(const Cluster *const pCluster) const
+{
+    ClusterLengthMap::const_iterator iter(m_clusterLengthSquaredMap.find(pCluster));
+
+    if (m_clusterLengthSquaredMap.end() != iter)
+        return iter->second;
+
+    CartesianVector innerCoordinate(0.f, 0.f, 0.f), outerCoordinate(0.f, 0.f, 0.f);
+    LArClusterHelper::GetExtremalCoordinates(pCluster, innerCoordinate, outerCoordinate);
+    const float lengthSquared((outerCoordinate - innerCoordinate).GetMagnitudeSquared());
+
+    (void) m_clusterLengthSquaredMap.insert(ClusterLengthMap::value_type(pCluster, lengthSquared));
+    return lengthSquared;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ShowerGrowingAlgorithm::RemoveCachedProperties(const Cluster *const pCluster) const
+{
+    m_clusterDirectionMap.erase(pCluster);
+    m_clusterLengthSquaredMap.erase(pCluster);
+    m_associationTypeMap.erase(pCluster);
+
+    for (ClusterAssociationTypeMap::value_type &mapEntry : m_associationTypeMap)
+        mapEntry.second.erase(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ShowerGrowingAlgorithm::ClearCachedProperties() const
+{
+    m_clusterDirectionMap.clear();
+    m_clusterLengthSquaredMap.clear();
+    m_associationTypeMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ShowerGrowingAlgorithm::SimpleModeShowerGrowing(const ClusterList *const pClusterList, const std::string &clusterListName) const
 {
     const VertexList *pVertexList(nullptr);
@@ -133,7 +202,7 @@ bool ShowerGrowingAlgorithm::GetNextSeedCandidate(const ClusterList *const pClus
 
     ClusterVector clusterVector;
     clusterVector.insert(clusterVector.end(), pClusterList->begin(), pClusterList->end());
-    std::sort(clusterVector.begin(), clusterVector.end(), ShowerGrowingAlgorithm::SortClusters);
+    this->SortClusterVector(clusterVector);
 
     for (const Cluster *const pCluster : clusterVector)
     {
@@ -170,6 +239,8 @@ void ShowerGrowingAlgorithm::GetAllVertexSeedCandidates(const ClusterList *const
     const HitType hitType(LArClusterHelper::GetClusterHitType(clusterVector.at(0)));
     const CartesianVector vertexPosition2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType));
 
+    LArPointingClusterList pointingClusterList;
+
     for (const Cluster *const pCluster : clusterVector)
     {
         if (!pCluster->IsAvailable())
@@ -181,17 +252,19 @@ void ShowerGrowingAlgorithm::GetAllVertexSeedCandidates(const ClusterList *const
         if (pCluster->GetNCaloHits() < m_minCaloHitsPerCluster)
             continue;
 
-        try
-        {
-            if (this->IsVertexAssociated(LArPointingCluster(pCluster), vertexPosition2D))
-                seedClusters.push_back(pCluster);
-        }
-        catch (StatusCodeException &)
-        {
-        }
+        try {pointingClusterList.push_back(LArPointingCluster(pCluster));} catch (StatusCodeException &) {}
     }
 
-    std::sort(seedClusters.begin(), seedClusters.end(), ShowerGrowingAlgorithm::SortClusters);
+    LArPointingClusterArrays::FlagVector isVertexAssociated;
+    this->GetVertexAssociations(pointingClusterList, vertexPosition2D, isVertexAssociated);
+
+    for (unsigned int i = 0; i < pointingClusterList.size(); ++i)
+    {
+        if (isVertexAssociated.at(i))
+            seedClusters.push_back(pointingClusterList.at(i).GetCluster());
+    }
+
+    this->SortClusterVector(seedClusters);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -203,9 +276,9 @@ void ShowerGrowingAlgorithm::GetSeedAssociationList(const ClusterVector &particl
         return;
 
     ClusterVector candidateClusters;
-    const ClusterList clusterList(*pClusterList);
+    const ClusterSet particleSeedSet(particleSeedVector.begin(), particleSeedVector.end());
 
-    for (const Cluster *const pCandidateCluster : clusterList)
+    for (const Cluster *const pCandidateCluster : *pClusterList)
     {
         if (!pCandidateCluster->IsAvailable())
             continue;
@@ -216,11 +289,11 @@ void ShowerGrowingAlgorithm::GetSeedAssociationList(const ClusterVector &particl
         if (pCandidateCluster->GetNCaloHits() < m_minCaloHitsPerCluster)
             continue;
 
-        if (particleSeedVector.end() == std::find(particleSeedVector.begin(), particleSeedVector.end(), pCandidateCluster))
+        if (!particleSeedSet.count(pCandidateCluster))
             candidateClusters.push_back(pCandidateCluster);
     }
 
-    std::sort(candidateClusters.begin(), candidateClusters.end(), ShowerGrowingAlgorithm::SortClusters);
+    this->SortClusterVector(candidateClusters);
     ClusterUsageMap forwardUsageMap, backwardUsageMap;
 
     for (const Cluster *const pSeedCluster : particleSeedVector)
@@ -254,7 +327,7 @@ void ShowerGrowingAlgorithm::ProcessSeedAssociationDetails(const SeedAssociation
 
 void ShowerGrowingAlgorithm::ProcessBranchClusters(const Cluster *const pParentCluster, const ClusterVector &branchClusters, const std::string &listName) const
 {
-    m_clusterDirectionMap.erase(pParentCluster);
+    this->RemoveCachedProperties(pParentCluster);
 
     for (const Cluster *const pBranchCluster : branchClusters)
     {
@@ -263,13 +336,30 @@ void ShowerGrowingAlgorithm::ProcessBranchClusters(const Cluster *const pParentC
             PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pParentCluster, pBranchCluster, listName, listName));
         }
 
-        m_clusterDirectionMap.erase(pBranchCluster);
+        this->RemoveCachedProperties(pBranchCluster);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 ShowerGrowingAlgorithm::AssociationType ShowerGrowingAlgorithm::AreClustersAssociated(const Cluster *const pClusterSeed, const Cluster *const pCluster) const
+{
+    // ATTN Associations are reused across seeds, until either cluster is changed by a merge
+    AssociationTypeMap &associationTypeMap(m_associationTypeMap[pClusterSeed]);
+    AssociationTypeMap::const_iterator iter(associationTypeMap.find(pCluster));
+
+    if (associationTypeMap.end() != iter)
+        return iter->second;
+
+    const AssociationType associationType(this->CalculateAssociationType(pClusterSeed, pCluster));
+    (void) associationTypeMap.insert(AssociationTypeMap::value_type(pCluster, associationType));
+
+    return associationType;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ShowerGrowingAlgorithm::AssociationType ShowerGrowingAlgorithm::CalculateAssociationType(const Cluster *const pClusterSeed, const Cluster *const pCluster) const
 {
     const VertexList *pVertexList(nullptr);
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pVertexList));
@@ -395,15 +485,9 @@ float ShowerGrowingAlgorithm::GetFigureOfMerit(const SeedAssociationList &seedAs
 
 unsigned int ShowerGrowingAlgorithm::GetNVertexConnections(const CartesianVector &vertexPosition2D, const LArPointingClusterList &pointingClusterList) const
 {
-    unsigned int nConnections(0);
-
-    for (LArPointingClusterList::const_iterator cIter = pointingClusterList.begin(), cIterEnd = pointingClusterList.end(); cIter != cIterEnd; ++cIter)
-    {
-        if (this->IsVertexAssociated(*cIter, vertexPosition2D))
-            ++nConnections;
-    }
+    this->GetVertexAssociations(pointingClusterList, vertexPosition2D, m_isVertexAssociated);
 
-    return nConnections;
+    return static_cast<unsigned int>(std::count(m_isVertexAssociated.begin(), m_isVertexAssociated.end(), 1));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArHelpers/LArVertexHelper.h"
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
+#include "larpandoracontent/LArObjects/LArPointingClusterArrays.h"
 
 #include "larpandoracontent/LArTrackShowerId/BranchGrowingAlgorithm.h"
 
@@ -43,6 +44,16 @@ protected:
      */
     bool IsVertexAssociated(const LArPointingCluster &pointingCluster, const pandora::CartesianVector &vertexPosition2D) const;
 
+    /**
+     *  @brief  Whether each of a list of pointing clusters is associated with a provided 2D vertex projection, as for IsVertexAssociated
+     *
+     *  @param  pointingClusterList the list of pointing clusters
+     *  @param  vertexPosition2D the projected vertex position
+     *  @param  isVertexAssociated to receive, for each pointing cluster, whether it is associated with the vertex
+     */
+    void GetVertexAssociations(const LArPointingClusterList &pointingClusterList, const pandora::CartesianVector &vertexPosition2D,
+        LArPointingClusterArrays::FlagVector &isVertexAssociated) const;
+
     /**
      *  @brief  Sorting for clusters to determine order in which seeds are considered
      *
@@ -54,9 +65,49 @@ protected:
     typedef std::unordered_map<const pandora::Cluster*, LArVertexHelper::ClusterDirection> ClusterDirectionMap;
     mutable ClusterDirectionMap m_clusterDirectionMap;          ///< The cluster direction map
 
+    typedef std::unordered_map<const pandora::Cluster*, float> ClusterLengthMap;
+    mutable ClusterLengthMap m_clusterLengthSquaredMap;         ///< The cluster extremal length squared map, used for sorting
+
+    typedef std::unordered_map<const pandora::Cluster*, AssociationType> AssociationTypeMap;
+    typedef std::unordered_map<const pandora::Cluster*, AssociationTypeMap> ClusterAssociationTypeMap;
+    mutable ClusterAssociationTypeMap m_associationTypeMap;     ///< The association types, indexed by seed cluster then candidate cluster
+
+    mutable LArPointingClusterArrays m_pointingClusterArrays;  ///< The pointing cluster vertices, storage reused by vertex association checks
+    mutable pandora::FloatVector m_longitudinalDisplacements;   ///< The vertex longitudinal impact parameters, storage reused likewise
+    mutable pandora::FloatVector m_transverseDisplacements;     ///< The vertex transverse impact parameters, storage reused likewise
+    mutable LArPointingClusterArrays::FlagVector m_isVertexAssociated; ///< The vertex association flags, storage reused likewise
+
 private:
     pandora::StatusCode Run();
 
+    /**
+     *  @brief  Sort clusters into the order of SortClusters, using cached extremal lengths
+     *
+     *  @param  clusterVector the vector of clusters to sort
+     */
+    void SortClusterVector(pandora::ClusterVector &clusterVector) const;
+
+    /**
+     *  @brief  Get the squared distance between the extremal coordinates of a cluster, caching the result
+     *
+     *  @param  pCluster address of the cluster
+     *
+     *  @return the squared extremal length
+     */
+    float GetExtremalLengthSquared(const pandora::Cluster *const pCluster) const;
+
+    /**
+     *  @brief  Remove all cached properties and associations of a cluster, which has been enlarged or deleted
+     *
+     *  @param  pCluster address of the cluster
+     */
+    void RemoveCachedProperties(const pandora::Cluster *const pCluster) const;
+
+    /**
+     *  @brief  Clear all cached cluster properties and associations
+     */
+    void ClearCachedProperties() const;
+
     /**
      *  @brief  Simple single-pass shower growing mode
      *
@@ -121,6 +172,16 @@ private:
 
     AssociationType AreClustersAssociated(const pandora::Cluster *const pClusterSeed, const pandora::Cluster *const pCluster) const;
 
+    /**
+     *  @brief  Calculate the association type for a seed cluster and a candidate cluster, which depends only on the two clusters
+     *
+     *  @param  pClusterSeed address of the seed cluster
+     *  @param  pCluster address of the candidate cluster
+     *
+     *  @return the association type
+     */
+    AssociationType CalculateAssociationType(const pandora::Cluster *const pClusterSeed, const pandora::Cluster *const pCluster) const;
+
     /**
      *  @brief  Get a figure of merit representing the consistency of the provided seed associated list
      *
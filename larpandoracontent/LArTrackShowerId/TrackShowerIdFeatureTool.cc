@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
+#include "larpandoracontent/LArObjects/LArSlidingFitCache.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 #include "larpandoracontent/LArTrackShowerId/CutClusterCharacterisationAlgorithm.h"
@@ -40,7 +41,9 @@ void TwoDShowerFitFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector
     float ratio(-1.f);
     try
     {
-        const TwoDSlidingFitResult slidingFitResultLarge(pCluster, m_slidingLinearFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const TwoDSlidingFitResultPtr spSlidingFitResultLarge(SlidingFitCache::GetSlidingFitResult(*this, pCluster, m_slidingLinearFitWindow, slidingFitPitch));
+        const TwoDSlidingFitResult &slidingFitResultLarge(*spSlidingFitResultLarge);
         const float straightLineLength = (slidingFitResultLarge.GetGlobalMaxLayerPosition() - slidingFitResultLarge.GetGlobalMinLayerPosition()).GetMagnitude();
         if (straightLineLength > std::numeric_limits<float>::epsilon())
             ratio = (CutClusterCharacterisationAlgorithm::GetShowerFitWidth(pAlgorithm, pCluster, m_slidingShowerFitWindow))/straightLineLength;
@@ -54,6 +57,15 @@ void TwoDShowerFitFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDShowerFitFeatureTool::Reset()
+{
+    SlidingFitCache::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDShowerFitFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -109,8 +121,11 @@ void TwoDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandora:
 {
     try
     {
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingLinearFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-        const TwoDSlidingFitResult slidingFitResultLarge(pCluster, m_slidingLinearFitWindowLarge, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const TwoDSlidingFitResultPtr spSlidingFitResult(SlidingFitCache::GetSlidingFitResult(*this, pCluster, m_slidingLinearFitWindow, slidingFitPitch));
+        const TwoDSlidingFitResult &slidingFitResult(*spSlidingFitResult);
+        const TwoDSlidingFitResultPtr spSlidingFitResultLarge(SlidingFitCache::GetSlidingFitResult(*this, pCluster, m_slidingLinearFitWindowLarge, slidingFitPitch));
+        const TwoDSlidingFitResult &slidingFitResultLarge(*spSlidingFitResultLarge);
 
         if (slidingFitResult.GetLayerFitResultMap().empty())
             throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
@@ -189,6 +204,15 @@ void TwoDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandora:
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDLinearFitFeatureTool::Reset()
+{
+    SlidingFitCache::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDLinearFitFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -219,7 +243,9 @@ void TwoDVertexDistanceFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureV
     float straightLineLength(-1.f), ratio(-1.f);
     try
     {
-        const TwoDSlidingFitResult slidingFitResultLarge(pCluster, m_slidingLinearFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const TwoDSlidingFitResultPtr spSlidingFitResultLarge(SlidingFitCache::GetSlidingFitResult(*this, pCluster, m_slidingLinearFitWindow, slidingFitPitch));
+        const TwoDSlidingFitResult &slidingFitResultLarge(*spSlidingFitResultLarge);
         straightLineLength = (slidingFitResultLarge.GetGlobalMaxLayerPosition() - slidingFitResultLarge.GetGlobalMinLayerPosition()).GetMagnitude();
         if (straightLineLength > std::numeric_limits<float>::epsilon())
             ratio = (CutClusterCharacterisationAlgorithm::GetVertexDistance(pAlgorithm, pCluster))/straightLineLength;
@@ -233,6 +259,15 @@ void TwoDVertexDistanceFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureV
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDVertexDistanceFeatureTool::Reset()
+{
+    SlidingFitCache::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDVertexDistanceFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -359,8 +394,11 @@ void ThreeDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandor
 {
     try
     {
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingLinearFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-        const TwoDSlidingFitResult slidingFitResultLarge(pCluster, m_slidingLinearFitWindowLarge, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const TwoDSlidingFitResultPtr spSlidingFitResult(SlidingFitCache::GetSlidingFitResult(*this, pCluster, m_slidingLinearFitWindow, slidingFitPitch));
+        const TwoDSlidingFitResult &slidingFitResult(*spSlidingFitResult);
+        const TwoDSlidingFitResultPtr spSlidingFitResultLarge(SlidingFitCache::GetSlidingFitResult(*this, pCluster, m_slidingLinearFitWindowLarge, slidingFitPitch));
+        const TwoDSlidingFitResult &slidingFitResultLarge(*spSlidingFitResultLarge);
 
         if (slidingFitResult.GetLayerFitResultMap().empty())
             throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
@@ -432,6 +470,15 @@ void ThreeDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandor
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ThreeDLinearFitFeatureTool::Reset()
+{
+    SlidingFitCache::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeDLinearFitFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -32,6 +32,7 @@ public:
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster);
 
 private:
+    pandora::StatusCode Reset();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
    /**
@@ -64,6 +65,7 @@ public:
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster);
 
 private:
+    pandora::StatusCode Reset();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     /**
@@ -100,6 +102,7 @@ public:
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster);
 
 private:
+    pandora::StatusCode Reset();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     /**
@@ -149,6 +152,7 @@ public:
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
 
 private:
+    pandora::StatusCode Reset();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     /**
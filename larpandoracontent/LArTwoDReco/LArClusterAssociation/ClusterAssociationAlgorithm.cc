@@ -36,6 +36,9 @@ StatusCode ClusterAssociationAlgorithm::Run()
     ClusterAssociationMap clusterAssociationMap;
     this->PopulateClusterAssociationMap(clusterVector, clusterAssociationMap);
 
+    ClusterReferences clusterReferences;
+    this->FillClusterReferences(clusterAssociationMap, clusterReferences);
+
     m_mergeMade = true;
 
     while (m_mergeMade)
@@ -47,12 +50,13 @@ StatusCode ClusterAssociationAlgorithm::Run()
 
             for (const Cluster *const pCluster : clusterVector)
             {
-                // ATTN The clusterVector may end up with dangling pointers; only protected by this check against managed cluster list
-                if (pClusterList->end() == std::find(pClusterList->begin(), pClusterList->end(), pCluster))
+                // ATTN The clusterVector may end up with dangling pointers; only protected by this check against up-to-date association list.
+                // Deleted clusters are always removed from the association map, and clusters absent from the map are not propagated.
+                if (clusterAssociationMap.end() == clusterAssociationMap.find(pCluster))
                     continue;
 
-                this->UnambiguousPropagation(pCluster, true,  clusterAssociationMap);
-                this->UnambiguousPropagation(pCluster, false, clusterAssociationMap);
+                this->UnambiguousPropagation(pCluster, true,  clusterAssociationMap, clusterReferences);
+                this->UnambiguousPropagation(pCluster, false, clusterAssociationMap, clusterReferences);
             }
         }
 
@@ -69,10 +73,10 @@ StatusCode ClusterAssociationAlgorithm::Run()
                 continue;
 
             if (mapIter->second.m_backwardAssociations.empty() && !mapIter->second.m_forwardAssociations.empty())
-                this->AmbiguousPropagation(pCluster, true, clusterAssociationMap);
+                this->AmbiguousPropagation(pCluster, true, clusterAssociationMap, clusterReferences);
 
             if (mapIter->second.m_forwardAssociations.empty() && !mapIter->second.m_backwardAssociations.empty())
-                this->AmbiguousPropagation(pCluster, false, clusterAssociationMap);
+                this->AmbiguousPropagation(pCluster, false, clusterAssociationMap, clusterReferences);
         }
     }
 
@@ -81,7 +85,22 @@ StatusCode ClusterAssociationAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ClusterAssociationAlgorithm::UnambiguousPropagation(const Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap) const
+void ClusterAssociationAlgorithm::FillClusterReferences(const ClusterAssociationMap &clusterAssociationMap, ClusterReferences &clusterReferences) const
+{
+    for (const ClusterAssociationMap::value_type &mapEntry : clusterAssociationMap)
+    {
+        for (const Cluster *const pForwardCluster : mapEntry.second.m_forwardAssociations)
+            (void) clusterReferences.m_forwardReferences[pForwardCluster].insert(mapEntry.first);
+
+        for (const Cluster *const pBackwardCluster : mapEntry.second.m_backwardAssociations)
+            (void) clusterReferences.m_backwardReferences[pBackwardCluster].insert(mapEntry.first);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterAssociationAlgorithm::UnambiguousPropagation(const Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap,
+    ClusterReferences &clusterReferences) const
 {
     const Cluster *const pClusterToEnlarge = pCluster;
     ClusterAssociationMap::iterator iterEnlarge = clusterAssociationMap.find(pClusterToEnlarge);
@@ -105,16 +124,18 @@ void ClusterAssociationAlgorithm::UnambiguousPropagation(const Cluster *const pC
     if (clusterSetDelete.size() != 1)
         return;
 
-    this->UpdateForUnambiguousMerge(pClusterToEnlarge, pClusterToDelete, isForward, clusterAssociationMap);
+    this->UpdateForUnambiguousMerge(pClusterToEnlarge, pClusterToDelete, isForward, clusterAssociationMap, clusterReferences);
+    this->UpdateForClusterMerge(pClusterToEnlarge, pClusterToDelete);
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pClusterToEnlarge, pClusterToDelete));
     m_mergeMade = true;
 
-    this->UnambiguousPropagation(pClusterToEnlarge, isForward, clusterAssociationMap);
+    this->UnambiguousPropagation(pClusterToEnlarge, isForward, clusterAssociationMap, clusterReferences);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ClusterAssociationAlgorithm::AmbiguousPropagation(const Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap) const
+void ClusterAssociationAlgorithm::AmbiguousPropagation(const Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap,
+    ClusterReferences &clusterReferences) const
 {
     ClusterAssociationMap::iterator cIter = clusterAssociationMap.find(pCluster);
 
@@ -147,7 +168,8 @@ void ClusterAssociationAlgorithm::AmbiguousPropagation(const Cluster *const pClu
 
     for (ClusterVector::iterator dIter = daughterClusterVector.begin(), dIterEnd = daughterClusterVector.end(); dIter != dIterEnd; ++dIter)
     {
-        this->UpdateForAmbiguousMerge(pCluster, *dIter, isForward, clusterAssociationMap);
+        this->UpdateForAmbiguousMerge(pCluster, *dIter, isForward, clusterAssociationMap, clusterReferences);
+        this->UpdateForClusterMerge(pCluster, *dIter);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pCluster, *dIter));
         m_mergeMade = true;
         *dIter = NULL;
@@ -156,8 +178,14 @@ void ClusterAssociationAlgorithm::AmbiguousPropagation(const Cluster *const pClu
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ClusterAssociationAlgorithm::UpdateForClusterMerge(const Cluster *const, const Cluster *const) const
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ClusterAssociationAlgorithm::UpdateForUnambiguousMerge(const Cluster *const pClusterToEnlarge, const Cluster *const pClusterToDelete, const bool isForwardMerge,
-    ClusterAssociationMap &clusterAssociationMap) const
+    ClusterAssociationMap &clusterAssociationMap, ClusterReferences &clusterReferences) const
 {
     ClusterAssociationMap::iterator iterEnlarge = clusterAssociationMap.find(pClusterToEnlarge);
     ClusterAssociationMap::iterator iterDelete = clusterAssociationMap.find(pClusterToDelete);
@@ -167,35 +195,32 @@ void ClusterAssociationAlgorithm::UpdateForUnambiguousMerge(const Cluster *const
 
     ClusterSet &clusterSetToMove(isForwardMerge ? iterDelete->second.m_forwardAssociations : iterDelete->second.m_backwardAssociations);
     ClusterSet &clusterSetToReplace(isForwardMerge ? iterEnlarge->second.m_forwardAssociations : iterEnlarge->second.m_backwardAssociations);
+    ClusterReferenceMap &referenceMapToReplace(isForwardMerge ? clusterReferences.m_forwardReferences : clusterReferences.m_backwardReferences);
+
+    for (const Cluster *const pReplacedCluster : clusterSetToReplace)
+        (void) referenceMapToReplace[pReplacedCluster].erase(pClusterToEnlarge);
+
     clusterSetToReplace = clusterSetToMove;
-    clusterAssociationMap.erase(iterDelete);
 
-    for (ClusterAssociationMap::iterator iter = clusterAssociationMap.begin(), iterEnd = clusterAssociationMap.end(); iter != iterEnd; ++iter)
-    {
-        ClusterSet &forwardClusters = iter->second.m_forwardAssociations;
-        ClusterSet &backwardClusters = iter->second.m_backwardAssociations;
+    for (const Cluster *const pMovedCluster : clusterSetToReplace)
+        (void) referenceMapToReplace[pMovedCluster].insert(pClusterToEnlarge);
 
-        ClusterSet::iterator forwardIter = forwardClusters.find(pClusterToDelete);
-        ClusterSet::iterator backwardIter = backwardClusters.find(pClusterToDelete);
+    for (const Cluster *const pForwardCluster : iterDelete->second.m_forwardAssociations)
+        (void) clusterReferences.m_forwardReferences[pForwardCluster].erase(pClusterToDelete);
 
-        if (forwardClusters.end() != forwardIter)
-        {
-            forwardClusters.erase(forwardIter);
-            forwardClusters.insert(pClusterToEnlarge);
-        }
+    for (const Cluster *const pBackwardCluster : iterDelete->second.m_backwardAssociations)
+        (void) clusterReferences.m_backwardReferences[pBackwardCluster].erase(pClusterToDelete);
 
-        if (backwardClusters.end() != backwardIter)
-        {
-            backwardClusters.erase(backwardIter);
-            backwardClusters.insert(pClusterToEnlarge);
-        }
-    }
+    clusterAssociationMap.erase(iterDelete);
+
+    this->ReplaceAssociations(pClusterToEnlarge, pClusterToDelete, true, clusterAssociationMap, clusterReferences);
+    this->ReplaceAssociations(pClusterToEnlarge, pClusterToDelete, false, clusterAssociationMap, clusterReferences);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ClusterAssociationAlgorithm::UpdateForAmbiguousMerge(const Cluster *const pClusterToEnlarge, const Cluster *const pClusterToDelete, const bool isForwardMerge,
-    ClusterAssociationMap &clusterAssociationMap) const
+    ClusterAssociationMap &clusterAssociationMap, ClusterReferences &clusterReferences) const
 {
     ClusterAssociationMap::iterator iterEnlarge = clusterAssociationMap.find(pClusterToEnlarge);
     ClusterAssociationMap::iterator iterDelete = clusterAssociationMap.find(pClusterToDelete);
@@ -205,6 +230,8 @@ void ClusterAssociationAlgorithm::UpdateForAmbiguousMerge(const Cluster *const p
 
     ClusterSet &clusterSetEnlarge(isForwardMerge ? iterEnlarge->second.m_forwardAssociations : iterEnlarge->second.m_backwardAssociations);
     ClusterSet &clusterSetDelete(isForwardMerge ? iterDelete->second.m_backwardAssociations : iterDelete->second.m_forwardAssociations);
+    ClusterReferenceMap &referenceMapEnlarge(isForwardMerge ? clusterReferences.m_forwardReferences : clusterReferences.m_backwardReferences);
+    ClusterReferenceMap &referenceMapDelete(isForwardMerge ? clusterReferences.m_backwardReferences : clusterReferences.m_forwardReferences);
 
     for (ClusterSet::iterator iter = clusterSetEnlarge.begin(); iter != clusterSetEnlarge.end();)
     {
@@ -223,6 +250,8 @@ void ClusterAssociationAlgorithm::UpdateForAmbiguousMerge(const Cluster *const p
                 throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
             associatedClusterSet.erase(enlargeIter);
+            (void) referenceMapDelete[pClusterToEnlarge].erase(*iter);
+            (void) referenceMapEnlarge[*iter].erase(pClusterToEnlarge);
             clusterSetEnlarge.erase(iter++);
         }
         else
@@ -248,6 +277,8 @@ void ClusterAssociationAlgorithm::UpdateForAmbiguousMerge(const Cluster *const p
                 throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
             associatedClusterSet.erase(deleteIter);
+            (void) referenceMapEnlarge[pClusterToDelete].erase(*iter);
+            (void) referenceMapDelete[*iter].erase(pClusterToDelete);
             clusterSetDelete.erase(iter++);
         }
         else
@@ -256,7 +287,41 @@ void ClusterAssociationAlgorithm::UpdateForAmbiguousMerge(const Cluster *const p
         }
     }
 
-    return this->UpdateForUnambiguousMerge(pClusterToEnlarge, pClusterToDelete, isForwardMerge, clusterAssociationMap);
+    return this->UpdateForUnambiguousMerge(pClusterToEnlarge, pClusterToDelete, isForwardMerge, clusterAssociationMap, clusterReferences);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterAssociationAlgorithm::ReplaceAssociations(const Cluster *const pClusterToEnlarge, const Cluster *const pClusterToDelete, const bool isForward,
+    ClusterAssociationMap &clusterAssociationMap, ClusterReferences &clusterReferences) const
+{
+    ClusterReferenceMap &referenceMap(isForward ? clusterReferences.m_forwardReferences : clusterReferences.m_backwardReferences);
+    ClusterReferenceMap::iterator referenceIter = referenceMap.find(pClusterToDelete);
+
+    if (referenceMap.end() == referenceIter)
+        return;
+
+    const ClusterSet referringClusterSet(std::move(referenceIter->second));
+    referenceMap.erase(referenceIter);
+
+    // ATTN Each association set receives the same operations as in a search of the whole map, so its contents and ordering are unchanged
+    for (const Cluster *const pReferringCluster : referringClusterSet)
+    {
+        ClusterAssociationMap::iterator iterAssociation = clusterAssociationMap.find(pReferringCluster);
+
+        if (clusterAssociationMap.end() == iterAssociation)
+            continue;
+
+        ClusterSet &associatedClusterSet(isForward ? iterAssociation->second.m_forwardAssociations : iterAssociation->second.m_backwardAssociations);
+        ClusterSet::iterator deleteIter = associatedClusterSet.find(pClusterToDelete);
+
+        if (associatedClusterSet.end() == deleteIter)
+            continue;
+
+        associatedClusterSet.erase(deleteIter);
+        associatedClusterSet.insert(pClusterToEnlarge);
+        (void) referenceMap[pClusterToEnlarge].insert(pReferringCluster);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -69,15 +69,46 @@ protected:
      */
     virtual bool IsExtremalCluster(const bool isForward, const pandora::Cluster *const pCurrentCluster, const pandora::Cluster *const pTestCluster) const = 0;
 
+    /**
+     *  @brief  Update any cluster properties held by the algorithm to reflect a cluster merge, called before the merge is made
+     *
+     *  @param  pClusterToEnlarge address of the cluster to be enlarged
+     *  @param  pClusterToDelete address of the cluster to be deleted
+     */
+    virtual void UpdateForClusterMerge(const pandora::Cluster *const pClusterToEnlarge, const pandora::Cluster *const pClusterToDelete) const;
+
 private:
+    typedef std::unordered_map<const pandora::Cluster*, pandora::ClusterSet> ClusterReferenceMap;
+
+    /**
+     *  @brief  ClusterReferences class, the reverse adjacency of a cluster association map, so that the clusters holding a given cluster
+     *          in their associations can be found without a search of the whole map
+     */
+    class ClusterReferences
+    {
+    public:
+        ClusterReferenceMap     m_forwardReferences;        ///< The clusters holding each cluster in their forward associations
+        ClusterReferenceMap     m_backwardReferences;       ///< The clusters holding each cluster in their backward associations
+    };
+
+    /**
+     *  @brief  Fill the reverse adjacency of a cluster association map
+     *
+     *  @param  clusterAssociationMap the cluster association map
+     *  @param  clusterReferences to receive the cluster references
+     */
+    void FillClusterReferences(const ClusterAssociationMap &clusterAssociationMap, ClusterReferences &clusterReferences) const;
+
     /**
      *  @brief  Unambiguous propagation
      *
      *  @param  pCluster address of the cluster to propagate
      *  @param  isForward whether propagation direction is forward
      *  @param  clusterAssociationMap the cluster association map
+     *  @param  clusterReferences the reverse adjacency of the cluster association map
      */
-    void UnambiguousPropagation(const pandora::Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap) const;
+    void UnambiguousPropagation(const pandora::Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap,
+        ClusterReferences &clusterReferences) const;
 
     /**
      *  @brief  Ambiguous propagation
@@ -85,8 +116,10 @@ private:
      *  @param  pCluster address of the cluster to propagate
      *  @param  isForward whether propagation direction is forward
      *  @param  clusterAssociationMap the cluster association map
+     *  @param  clusterReferences the reverse adjacency of the cluster association map
      */
-    void AmbiguousPropagation(const pandora::Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap) const;
+    void AmbiguousPropagation(const pandora::Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap,
+        ClusterReferences &clusterReferences) const;
 
     /**
      *  @brief  Update cluster association map to reflect an unambiguous cluster merge
@@ -95,9 +128,10 @@ private:
      *  @param  pClusterToDelete address of the cluster to be deleted
      *  @param  isForwardMerge whether merge is forward (pClusterToEnlarge is forward-associated with pClusterToDelete)
      *  @param  clusterAssociationMap the cluster association map
+     *  @param  clusterReferences the reverse adjacency of the cluster association map
      */
     void UpdateForUnambiguousMerge(const pandora::Cluster *const pClusterToEnlarge, const pandora::Cluster *const pClusterToDelete, const bool isForwardMerge,
-        ClusterAssociationMap &clusterAssociationMap) const;
+        ClusterAssociationMap &clusterAssociationMap, ClusterReferences &clusterReferences) const;
 
     /**
      *  @brief  Update cluster association map to reflect an ambiguous cluster merge
@@ -106,9 +140,22 @@ private:
      *  @param  pClusterToDelete address of the cluster to be deleted
      *  @param  isForwardMerge whether merge is forward (pClusterToEnlarge is forward-associated with pClusterToDelete)
      *  @param  clusterAssociationMap the cluster association map
+     *  @param  clusterReferences the reverse adjacency of the cluster association map
      */
     void UpdateForAmbiguousMerge(const pandora::Cluster *const pClusterToEnlarge, const pandora::Cluster *const pClusterToDelete, const bool isForwardMerge,
-        ClusterAssociationMap &clusterAssociationMap) const;
+        ClusterAssociationMap &clusterAssociationMap, ClusterReferences &clusterReferences) const;
+
+    /**
+     *  @brief  Replace a deleted cluster with the cluster it was merged into, in the associations of all clusters holding the deleted cluster
+     *
+     *  @param  pClusterToEnlarge address of the enlarged cluster
+     *  @param  pClusterToDelete address of the deleted cluster
+     *  @param  isForward whether to update forward (rather than backward) associations
+     *  @param  clusterAssociationMap the cluster association map
+     *  @param  clusterReferences the reverse adjacency of the cluster association map
+     */
+    void ReplaceAssociations(const pandora::Cluster *const pClusterToEnlarge, const pandora::Cluster *const pClusterToDelete, const bool isForward,
+        ClusterAssociationMap &clusterAssociationMap, ClusterReferences &clusterReferences) const;
 
     /**
      *  @brief  Navigate along cluster associations, from specified cluster, in specified direction
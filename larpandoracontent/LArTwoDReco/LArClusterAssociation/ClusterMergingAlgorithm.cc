@@ -17,8 +17,20 @@ using namespace pandora;
 namespace lar_content
 {
 
+ClusterMergingAlgorithm::ClusterMergingAlgorithm() :
+    m_incrementalMerging(true),
+    m_nMergePasses(0),
+    m_nPairTests(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterMergingAlgorithm::Run()
 {
+    m_nMergePasses = 0;
+    m_nPairTests = 0;
+
     const ClusterList *pClusterList = NULL;
 
     if (m_inputClusterListName.empty())
@@ -38,6 +50,9 @@ StatusCode ClusterMergingAlgorithm::Run()
         return STATUS_CODE_SUCCESS;
     }
 
+    const bool usePairwiseAssociations(m_incrementalMerging && this->HasPairwiseAssociations());
+    ClusterSet previousClusters, modifiedClusters;
+
     while (true)
     {
         ClusterVector unsortedVector, clusterVector;
@@ -45,12 +60,34 @@ StatusCode ClusterMergingAlgorithm::Run()
         this->GetSortedListOfCleanClusters(unsortedVector, clusterVector);
 
         ClusterMergeMap clusterMergeMap;
-        this->PopulateClusterMergeMap(clusterVector, clusterMergeMap);
+
+        if (usePairwiseAssociations)
+        {
+            this->PopulatePairwiseClusterMergeMap(clusterVector, (0 == m_nMergePasses), previousClusters, modifiedClusters, clusterMergeMap, m_nPairTests);
+        }
+        else
+        {
+            this->PopulateClusterMergeMap(clusterVector, clusterMergeMap);
+        }
+
+        ++m_nMergePasses;
 
         if (clusterMergeMap.empty())
             break;
 
-        this->MergeClusters(clusterVector, clusterMergeMap);
+        previousClusters = ClusterSet(clusterVector.begin(), clusterVector.end());
+        modifiedClusters.clear();
+        this->MergeClusters(clusterVector, clusterMergeMap, modifiedClusters);
+    }
+
+    if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+    {
+        std::cout << "ClusterMergingAlgorithm: " << this->GetType() << " (" << this->GetInstanceName() << "), passes " << m_nMergePasses;
+
+        if (usePairwiseAssociations)
+            std::cout << ", pair tests " << m_nPairTests;
+
+        std::cout << std::endl;
     }
 
     return STATUS_CODE_SUCCESS;
@@ -58,7 +95,52 @@ StatusCode ClusterMergingAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ClusterMergingAlgorithm::MergeClusters(ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const
+bool ClusterMergingAlgorithm::HasPairwiseAssociations() const
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ClusterMergingAlgorithm::IsPairAssociated(const Cluster *const, const Cluster *const) const
+{
+    throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterMergingAlgorithm::PopulatePairwiseClusterMergeMap(const ClusterVector &clusterVector, const bool isFirstPass, const ClusterSet &previousClusters,
+    const ClusterSet &modifiedClusters, ClusterMergeMap &clusterMergeMap, unsigned int &nPairTests) const
+{
+    std::vector<bool> changedFlags;
+
+    for (const Cluster *const pCluster : clusterVector)
+        changedFlags.push_back(isFirstPass || !previousClusters.count(pCluster) || modifiedClusters.count(pCluster));
+
+    for (unsigned int i = 0; i < clusterVector.size(); ++i)
+    {
+        const Cluster *const pClusterI(clusterVector.at(i));
+
+        for (unsigned int j = i + 1; j < clusterVector.size(); ++j)
+        {
+            if (!changedFlags.at(i) && !changedFlags.at(j))
+                continue;
+
+            const Cluster *const pClusterJ(clusterVector.at(j));
+            ++nPairTests;
+
+            if (this->IsPairAssociated(pClusterI, pClusterJ))
+            {
+                clusterMergeMap[pClusterI].push_back(pClusterJ);
+                clusterMergeMap[pClusterJ].push_back(pClusterI);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterMergingAlgorithm::MergeClusters(ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap, ClusterSet &modifiedClusters) const
 {
     ClusterSet clusterVetoList;
 
@@ -68,6 +150,9 @@ void ClusterMergingAlgorithm::MergeClusters(ClusterVector &clusterVector, Cluste
         this->CollectAssociatedClusters(pSeedCluster, pSeedCluster, clusterMergeMap, clusterVetoList, mergeList);
         mergeList.sort(LArClusterHelper::SortByNHits);
 
+        if (!mergeList.empty())
+            (void) modifiedClusters.insert(pSeedCluster);
+
         for (const Cluster *const pAssociatedCluster : mergeList)
         {
             if (clusterVetoList.count(pAssociatedCluster))
@@ -162,6 +247,9 @@ StatusCode ClusterMergingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "InputClusterListName", m_inputClusterListName));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "IncrementalMerging", m_incrementalMerging));
+
     return STATUS_CODE_SUCCESS;
 }
 
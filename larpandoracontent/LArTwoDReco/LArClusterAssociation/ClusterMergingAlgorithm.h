@@ -20,6 +20,26 @@ namespace lar_content
  */
 class ClusterMergingAlgorithm : public pandora::Algorithm
 {
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ClusterMergingAlgorithm();
+
+    /**
+     *  @brief  Get the number of merge passes made in the last call to Run
+     *
+     *  @return the number of merge passes
+     */
+    unsigned int GetNMergePasses() const;
+
+    /**
+     *  @brief  Get the number of pairwise association tests made in the last call to Run, zero if pairwise associations are not used
+     *
+     *  @return the number of pair tests
+     */
+    unsigned int GetNPairTests() const;
+
 protected:
     virtual pandora::StatusCode Run();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -42,13 +62,47 @@ protected:
      */
     virtual void PopulateClusterMergeMap(const pandora::ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const = 0;
 
+    /**
+     *  @brief  Whether the cluster merge map is formed from independent tests of pairs of clean clusters, provided by IsPairAssociated.
+     *          If so, merge passes after the first only repeat the tests for pairs including a cluster changed by the previous pass.
+     *
+     *  @return boolean
+     */
+    virtual bool HasPairwiseAssociations() const;
+
+    /**
+     *  @brief  Whether a pair of clean clusters should be merged. The result must depend only on the two clusters, and the function is
+     *          only called if HasPairwiseAssociations returns true.
+     *
+     *  @param  pClusterI address of the first cluster, which precedes the second in the sorted vector of clean clusters
+     *  @param  pClusterJ address of the second cluster
+     *
+     *  @return boolean
+     */
+    virtual bool IsPairAssociated(const pandora::Cluster *const pClusterI, const pandora::Cluster *const pClusterJ) const;
+
+    /**
+     *  @brief  Form the cluster merge map from pairwise association tests, testing only pairs including a changed cluster. Pairs of
+     *          unchanged clusters cannot be associated, as the previous pass merged at least one cluster from every associated pair.
+     *
+     *  @param  clusterVector the vector of clean clusters
+     *  @param  isFirstPass whether this is the first merge pass, in which all pairs are tested
+     *  @param  previousClusters the clean clusters in the previous merge pass
+     *  @param  modifiedClusters the clusters enlarged by the previous merge pass
+     *  @param  clusterMergeMap the matrix of cluster associations
+     *  @param  nPairTests to receive the incremented number of pair tests
+     */
+    void PopulatePairwiseClusterMergeMap(const pandora::ClusterVector &clusterVector, const bool isFirstPass, const pandora::ClusterSet &previousClusters,
+        const pandora::ClusterSet &modifiedClusters, ClusterMergeMap &clusterMergeMap, unsigned int &nPairTests) const;
+
     /**
      *  @brief  Merge associated clusters
      *
      *  @param  clusterVector the vector of clean clusters
      *  @param  clusterMergeMap the matrix of cluster associations
+     *  @param  modifiedClusters to receive the clusters enlarged by the merges
      */
-    void MergeClusters(pandora::ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const;
+    void MergeClusters(pandora::ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap, pandora::ClusterSet &modifiedClusters) const;
 
     /**
      *  @brief  Collect up all clusters associations related to a given seed cluster
@@ -80,8 +134,25 @@ protected:
     void GetSortedListOfCleanClusters(const pandora::ClusterVector &inputClusters, pandora::ClusterVector &outputClusters) const;
 
     std::string     m_inputClusterListName;     ///< The name of the input cluster list. If not specified, will access current list.
+    bool            m_incrementalMerging;       ///< Whether to only repeat pairwise association tests for changed clusters, if supported
+    unsigned int    m_nMergePasses;             ///< The number of merge passes made in the last call to Run
+    unsigned int    m_nPairTests;               ///< The number of pairwise association tests made in the last call to Run
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int ClusterMergingAlgorithm::GetNMergePasses() const
+{
+    return m_nMergePasses;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int ClusterMergingAlgorithm::GetNPairTests() const
+{
+    return m_nPairTests;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_CLUSTER_MERGING_ALGORITHM_H
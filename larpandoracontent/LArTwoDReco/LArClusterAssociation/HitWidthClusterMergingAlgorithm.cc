@@ -98,12 +98,10 @@ void HitWidthClusterMergingAlgorithm::PopulateClusterAssociationMap(const Cluste
 
 bool HitWidthClusterMergingAlgorithm::IsExtremalCluster(const bool isForward, const Cluster *const pCurrentCluster,  const Cluster *const pTestCluster) const
 {
-    //ATTN - cannot use map since higherXExtrema may have changed during merging
-    const LArHitWidthHelper::ConstituentHitVector currentConstituentHitVector(LArHitWidthHelper::GetConstituentHits(pCurrentCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const LArHitWidthHelper::ConstituentHitVector testConstituentHitVector(LArHitWidthHelper::GetConstituentHits(pTestCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const CartesianVector currentHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(currentConstituentHitVector));
-    const CartesianVector testHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(testConstituentHitVector));
-    float currentMaxX(currentHigherXExtrema.GetX()), testMaxX(testHigherXExtrema.GetX());
+    // ATTN The map entries are updated for each merge, see UpdateForClusterMerge, so hold the current higherXExtrema
+    const CartesianVector &currentHigherXExtrema(LArHitWidthHelper::GetClusterParameters(pCurrentCluster, m_clusterToParametersMap).GetHigherXExtrema());
+    const CartesianVector &testHigherXExtrema(LArHitWidthHelper::GetClusterParameters(pTestCluster, m_clusterToParametersMap).GetHigherXExtrema());
+    const float currentMaxX(currentHigherXExtrema.GetX()), testMaxX(testHigherXExtrema.GetX());
 
     if (isForward)
     {
@@ -121,6 +119,19 @@ bool HitWidthClusterMergingAlgorithm::IsExtremalCluster(const bool isForward, co
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void HitWidthClusterMergingAlgorithm::UpdateForClusterMerge(const Cluster *const pClusterToEnlarge, const Cluster *const pClusterToDelete) const
+{
+    // ATTN Combine the existing constituent hits, in the order a rebuild would give, rather than breaking up the hits of the merged cluster again
+    const LArHitWidthHelper::ClusterParameters mergedClusterParameters(LArHitWidthHelper::GetClusterParameters(pClusterToEnlarge, m_clusterToParametersMap),
+        LArHitWidthHelper::GetClusterParameters(pClusterToDelete, m_clusterToParametersMap));
+
+    m_clusterToParametersMap.erase(pClusterToEnlarge);
+    m_clusterToParametersMap.erase(pClusterToDelete);
+    m_clusterToParametersMap.insert(std::pair<const Cluster*, LArHitWidthHelper::ClusterParameters>(pClusterToEnlarge, mergedClusterParameters));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool HitWidthClusterMergingAlgorithm::AreClustersAssociated(const LArHitWidthHelper::ClusterParameters &currentFitParameters,
     const LArHitWidthHelper::ClusterParameters &testFitParameters) const
 {
@@ -32,6 +32,7 @@ private:
     void GetListOfCleanClusters(const pandora::ClusterList *const pClusterList, pandora::ClusterVector &clusterVector) const;
     void PopulateClusterAssociationMap(const pandora::ClusterVector &clusterVector, ClusterAssociationMap &clusterAssociationMap) const;
     bool IsExtremalCluster(const bool isForward, const pandora::Cluster *const pCurrentCluster,  const pandora::Cluster *const pTestCluster) const;
+    void UpdateForClusterMerge(const pandora::Cluster *const pClusterToEnlarge, const pandora::Cluster *const pClusterToDelete) const;
 
     /**
      *  @brief  Determine whether two clusters are associated
@@ -137,7 +138,7 @@ private:
     float m_minClusterSparseness;             ///< The threshold sparseness of a cluster to be considered in the merging process
 
     // ATTN Dangling pointers emerge during cluster merging, here explicitly not dereferenced
-    mutable LArHitWidthHelper::ClusterToParametersMap m_clusterToParametersMap;   ///< The map [cluster -> cluster parameters]
+    mutable LArHitWidthHelper::ClusterToParametersMap m_clusterToParametersMap;   ///< The map [cluster -> cluster parameters], updated for each merge
 };
 
 } //namespace lar_content
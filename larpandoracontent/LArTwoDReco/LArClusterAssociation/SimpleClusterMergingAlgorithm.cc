@@ -58,7 +58,7 @@ void SimpleClusterMergingAlgorithm::PopulateClusterMergeMap(const ClusterVector
             if (pClusterI == pClusterJ)
                 continue;
 
-            if (this->IsAssociated(pClusterI, pClusterJ))
+            if (this->IsPairAssociated(pClusterI, pClusterJ))
             {
                 clusterMergeMap[pClusterI].push_back(pClusterJ);
                 clusterMergeMap[pClusterJ].push_back(pClusterI);
@@ -69,7 +69,14 @@ void SimpleClusterMergingAlgorithm::PopulateClusterMergeMap(const ClusterVector
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool SimpleClusterMergingAlgorithm::IsAssociated(const Cluster* const pClusterI, const Cluster* const pClusterJ) const
+bool SimpleClusterMergingAlgorithm::HasPairwiseAssociations() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool SimpleClusterMergingAlgorithm::IsPairAssociated(const Cluster *const pClusterI, const Cluster *const pClusterJ) const
 {
     if (LArClusterHelper::GetClosestDistance(pClusterI,pClusterJ) > m_maxClusterSeparation)
         return false;
@@ -29,16 +29,8 @@ public:
 private:
     void GetListOfCleanClusters(const pandora::ClusterList *const pClusterList, pandora::ClusterVector &clusterVector) const;
     void PopulateClusterMergeMap(const pandora::ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const;
-
-    /**
-     *  @brief Decide whether two clusters are associated
-     *
-     *  @param pClusterI the address of the first cluster
-     *  @param pClusterJ the address of the second cluster
-     *
-     *  @return boolean
-     */
-    bool IsAssociated(const pandora::Cluster* const pClusterI, const pandora::Cluster* const pClusterJ) const;
+    bool HasPairwiseAssociations() const;
+    bool IsPairAssociated(const pandora::Cluster *const pClusterI, const pandora::Cluster *const pClusterJ) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -38,6 +38,13 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
     ClusterVector sortedRemnantClusters(remnantClusters.begin(), remnantClusters.end());
     std::sort(sortedRemnantClusters.begin(), sortedRemnantClusters.end(), LArClusterHelper::SortByNHits);
 
+    ExtentVector remnantExtents;
+
+    for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+        remnantExtents.push_back(Extent(pRemnantCluster));
+
+    const ExtentIndex remnantExtentIndex(remnantExtents);
+
     for (const Cluster *const pPfoCluster : sortedPfoClusters)
     {
         const TwoDSlidingShowerFitResult fitResult(pPfoCluster, m_slidingFitWindow, slidingFitPitch, m_showerEdgeMultiplier);
@@ -46,8 +53,21 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
         const XSampling xSampling(fitResult.GetShowerFitResult());
         this->GetShowerPositionMap(fitResult, xSampling, showerPositionMap);
 
-        for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+        // ATTN Remnant clusters outside the shower envelope have no bounded hits, so can only pass a non-positive bounded fraction cut
+        IndexVector remnantIndices;
+
+        if (m_minBoundedFraction > 0.f)
+        {
+            remnantExtentIndex.GetOverlappingIndices(this->GetShowerExtent(xSampling, showerPositionMap), remnantIndices);
+        }
+        else
+        {
+            remnantExtentIndex.GetAllIndices(remnantIndices);
+        }
+
+        for (const unsigned int remnantIndex : remnantIndices)
         {
+            const Cluster *const pRemnantCluster(sortedRemnantClusters.at(remnantIndex));
             const float boundedFraction(this->GetBoundedFraction(pRemnantCluster, xSampling, showerPositionMap));
 
             if (boundedFraction < m_minBoundedFraction)
@@ -93,6 +113,23 @@ void BoundedClusterMopUpAlgorithm::GetShowerPositionMap(const TwoDSlidingShowerF
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+ClusterMopUpBaseAlgorithm::Extent BoundedClusterMopUpAlgorithm::GetShowerExtent(const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const
+{
+    // ATTN Allow for the tolerance used when converting x positions to sampling bins
+    const float tolerance(std::numeric_limits<float>::epsilon());
+    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (const ShowerPositionMap::value_type &mapEntry : showerPositionMap)
+    {
+        minZ = std::min(minZ, mapEntry.second.GetLowEdgeZ());
+        maxZ = std::max(maxZ, mapEntry.second.GetHighEdgeZ());
+    }
+
+    return Extent(xSampling.m_minX - tolerance, xSampling.m_maxX + tolerance, minZ, maxZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float BoundedClusterMopUpAlgorithm::GetBoundedFraction(const Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const
 {
   if (((xSampling.m_maxX - xSampling.m_minX) < std::numeric_limits<float>::epsilon()) || (0 >= xSampling.m_nPoints) ||
@@ -66,6 +66,16 @@ private:
      */
     void GetShowerPositionMap(const TwoDSlidingShowerFitResult &fitResult, const XSampling &xSampling, ShowerPositionMap &showerPositionMap) const;
 
+    /**
+     *  @brief  Get the region of the x-z plane containing all positions bounded by a specified shower position map
+     *
+     *  @param  xSampling the x sampling details
+     *  @param  showerPositionMap the shower position map
+     *
+     *  @return the region
+     */
+    Extent GetShowerExtent(const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const;
+
     /**
      *  @brief  Get the fraction of hits in a cluster bounded by a specified shower position map
      *
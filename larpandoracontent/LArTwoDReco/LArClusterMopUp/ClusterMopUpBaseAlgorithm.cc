@@ -13,6 +13,10 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterMopUp/ClusterMopUpBaseAlgorithm.h"
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
 using namespace pandora;
 
 namespace lar_content
@@ -136,6 +140,156 @@ void ClusterMopUpBaseAlgorithm::MakeClusterMerges(const ClusterAssociationMap &c
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ClusterMopUpBaseAlgorithm::Extent::Extent(const float minX, const float maxX, const float minZ, const float maxZ) :
+    m_minX(minX),
+    m_maxX(maxX),
+    m_minZ(minZ),
+    m_maxZ(maxZ)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ClusterMopUpBaseAlgorithm::Extent::Extent(const Cluster *const pCluster)
+{
+    CartesianVector minimumCoordinate(0.f, 0.f, 0.f), maximumCoordinate(0.f, 0.f, 0.f);
+    LArClusterHelper::GetClusterBoundingBox(pCluster, minimumCoordinate, maximumCoordinate);
+
+    m_minX = minimumCoordinate.GetX();
+    m_maxX = maximumCoordinate.GetX();
+    m_minZ = minimumCoordinate.GetZ();
+    m_maxZ = maximumCoordinate.GetZ();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ClusterMopUpBaseAlgorithm::Extent ClusterMopUpBaseAlgorithm::Extent::GetExpanded(const float distance) const
+{
+    return Extent(m_minX - distance, m_maxX + distance, m_minZ - distance, m_maxZ + distance);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ClusterMopUpBaseAlgorithm::Extent::Overlaps(const Extent &other) const
+{
+    return ((m_minX <= other.m_maxX) && (other.m_minX <= m_maxX) && (m_minZ <= other.m_maxZ) && (other.m_minZ <= m_maxZ));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ClusterMopUpBaseAlgorithm::ExtentIndex::ExtentIndex(const ExtentVector &extentVector) :
+    m_extentVector(extentVector),
+    m_minX(0.f),
+    m_minZ(0.f),
+    m_binWidthX(1.f),
+    m_binWidthZ(1.f),
+    m_nBinsX(1),
+    m_nBinsZ(1)
+{
+    float maxX(-std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+    m_minX = std::numeric_limits<float>::max();
+    m_minZ = std::numeric_limits<float>::max();
+
+    for (const Extent &extent : m_extentVector)
+    {
+        m_minX = std::min(m_minX, extent.m_minX);
+        m_minZ = std::min(m_minZ, extent.m_minZ);
+        maxX = std::max(maxX, extent.m_maxX);
+        maxZ = std::max(maxZ, extent.m_maxZ);
+    }
+
+    // ATTN Roughly one extent per bin for evenly spread extents, with a cap on the number of bins a single large extent can occupy
+    const unsigned int maxBinsPerAxis(64);
+    const unsigned int nBins(std::min(maxBinsPerAxis, static_cast<unsigned int>(std::ceil(std::sqrt(static_cast<float>(m_extentVector.size()))))));
+
+    if ((nBins > 1) && (maxX > m_minX))
+    {
+        m_nBinsX = nBins;
+        m_binWidthX = (maxX - m_minX) / static_cast<float>(nBins);
+    }
+
+    if ((nBins > 1) && (maxZ > m_minZ))
+    {
+        m_nBinsZ = nBins;
+        m_binWidthZ = (maxZ - m_minZ) / static_cast<float>(nBins);
+    }
+
+    m_binVector.resize(m_nBinsX * m_nBinsZ);
+
+    for (unsigned int index = 0; index < m_extentVector.size(); ++index)
+    {
+        const Extent &extent(m_extentVector.at(index));
+
+        unsigned int minBinX(0), maxBinX(0), minBinZ(0), maxBinZ(0);
+        ExtentIndex::GetBinRange(extent.m_minX, extent.m_maxX, m_minX, m_binWidthX, m_nBinsX, minBinX, maxBinX);
+        ExtentIndex::GetBinRange(extent.m_minZ, extent.m_maxZ, m_minZ, m_binWidthZ, m_nBinsZ, minBinZ, maxBinZ);
+
+        for (unsigned int binX = minBinX; binX <= maxBinX; ++binX)
+        {
+            for (unsigned int binZ = minBinZ; binZ <= maxBinZ; ++binZ)
+                m_binVector.at(binX * m_nBinsZ + binZ).push_back(index);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterMopUpBaseAlgorithm::ExtentIndex::GetOverlappingIndices(const Extent &region, IndexVector &indices) const
+{
+    indices.clear();
+
+    if (m_extentVector.empty())
+        return;
+
+    const float tolerance(0.1f);
+    const Extent expandedRegion(region.GetExpanded(tolerance));
+
+    unsigned int minBinX(0), maxBinX(0), minBinZ(0), maxBinZ(0);
+    ExtentIndex::GetBinRange(expandedRegion.m_minX, expandedRegion.m_maxX, m_minX, m_binWidthX, m_nBinsX, minBinX, maxBinX);
+    ExtentIndex::GetBinRange(expandedRegion.m_minZ, expandedRegion.m_maxZ, m_minZ, m_binWidthZ, m_nBinsZ, minBinZ, maxBinZ);
+
+    for (unsigned int binX = minBinX; binX <= maxBinX; ++binX)
+    {
+        for (unsigned int binZ = minBinZ; binZ <= maxBinZ; ++binZ)
+        {
+            for (const unsigned int index : m_binVector.at(binX * m_nBinsZ + binZ))
+            {
+                if (m_extentVector.at(index).Overlaps(expandedRegion))
+                    indices.push_back(index);
+            }
+        }
+    }
+
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterMopUpBaseAlgorithm::ExtentIndex::GetAllIndices(IndexVector &indices) const
+{
+    indices.resize(m_extentVector.size());
+    std::iota(indices.begin(), indices.end(), 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterMopUpBaseAlgorithm::ExtentIndex::GetBinRange(const float minValue, const float maxValue, const float gridMin, const float binWidth,
+    const unsigned int nBins, unsigned int &minBin, unsigned int &maxBin)
+{
+    const float maxBinPosition(static_cast<float>(nBins - 1));
+    const float minPosition(std::floor((minValue - gridMin) / binWidth));
+    const float maxPosition(std::floor((maxValue - gridMin) / binWidth));
+
+    minBin = static_cast<unsigned int>(std::max(0.f, std::min(maxBinPosition, minPosition)));
+    maxBin = static_cast<unsigned int>(std::max(0.f, std::min(maxBinPosition, maxPosition)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode ClusterMopUpBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
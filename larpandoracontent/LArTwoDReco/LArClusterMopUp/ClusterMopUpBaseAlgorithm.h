@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArUtility/MopUpBaseAlgorithm.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace lar_content
 {
@@ -68,6 +69,114 @@ protected:
      */
     virtual void ClusterMopUp(const pandora::ClusterList &pfoClusters, const pandora::ClusterList &remnantClusters) const = 0;
 
+    /**
+     *  @brief  Extent class, describing an axis-aligned region in the x-z plane
+     */
+    class Extent
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  minX the minimum x coordinate
+         *  @param  maxX the maximum x coordinate
+         *  @param  minZ the minimum z coordinate
+         *  @param  maxZ the maximum z coordinate
+         */
+        Extent(const float minX, const float maxX, const float minZ, const float maxZ);
+
+        /**
+         *  @brief  Constructor, using the bounding box of the hits in a cluster
+         *
+         *  @param  pCluster address of the cluster
+         */
+        Extent(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Get a copy of this extent, expanded in each direction
+         *
+         *  @param  distance the distance by which to expand
+         *
+         *  @return the expanded extent
+         */
+        Extent GetExpanded(const float distance) const;
+
+        /**
+         *  @brief  Whether this extent overlaps another, including touching at the boundaries
+         *
+         *  @param  other the other extent
+         *
+         *  @return boolean
+         */
+        bool Overlaps(const Extent &other) const;
+
+        float   m_minX;     ///< The minimum x coordinate
+        float   m_maxX;     ///< The maximum x coordinate
+        float   m_minZ;     ///< The minimum z coordinate
+        float   m_maxZ;     ///< The maximum z coordinate
+    };
+
+    typedef std::vector<Extent> ExtentVector;
+    typedef std::vector<unsigned int> IndexVector;
+
+    /**
+     *  @brief  ExtentIndex class, a uniform grid in the x-z plane over a vector of extents, so that the extents overlapping a given region
+     *          can be found without testing every extent. Built once per view, and used to restrict the remnant clusters tested against
+     *          each pfo cluster to those that could possibly be associated. Query regions are expanded by a small tolerance, so that
+     *          rounding in their calculation cannot exclude an extent.
+     */
+    class ExtentIndex
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  extentVector the extents to index
+         */
+        ExtentIndex(const ExtentVector &extentVector);
+
+        /**
+         *  @brief  Get the indices of the extents overlapping a region
+         *
+         *  @param  region the region
+         *  @param  indices to receive the indices of the overlapping extents, in increasing order
+         */
+        void GetOverlappingIndices(const Extent &region, IndexVector &indices) const;
+
+        /**
+         *  @brief  Get the indices of all the extents
+         *
+         *  @param  indices to receive the indices, in increasing order
+         */
+        void GetAllIndices(IndexVector &indices) const;
+
+    private:
+        /**
+         *  @brief  Get the range of grid bins covered by an interval along one axis, clamped to the grid
+         *
+         *  @param  minValue the interval minimum
+         *  @param  maxValue the interval maximum
+         *  @param  gridMin the grid minimum along the axis
+         *  @param  binWidth the grid bin width along the axis
+         *  @param  nBins the number of grid bins along the axis
+         *  @param  minBin to receive the first bin
+         *  @param  maxBin to receive the last bin
+         */
+        static void GetBinRange(const float minValue, const float maxValue, const float gridMin, const float binWidth, const unsigned int nBins,
+            unsigned int &minBin, unsigned int &maxBin);
+
+        typedef std::vector<IndexVector> BinVector;
+
+        ExtentVector    m_extentVector;     ///< The indexed extents
+        float           m_minX;             ///< The grid minimum x coordinate
+        float           m_minZ;             ///< The grid minimum z coordinate
+        float           m_binWidthX;        ///< The grid bin width in x
+        float           m_binWidthZ;        ///< The grid bin width in z
+        unsigned int    m_nBinsX;           ///< The number of grid bins in x
+        unsigned int    m_nBinsZ;           ///< The number of grid bins in z
+        BinVector       m_binVector;        ///< The indices of the extents overlapping each grid bin
+    };
+
     typedef std::unordered_map<const pandora::Cluster*, float> AssociationDetails;
     typedef std::unordered_map<const pandora::Cluster*, AssociationDetails> ClusterAssociationMap;
 
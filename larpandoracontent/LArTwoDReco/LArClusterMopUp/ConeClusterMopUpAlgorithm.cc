@@ -50,6 +50,13 @@ void ConeClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, con
     ClusterVector sortedRemnantClusters(remnantClusters.begin(), remnantClusters.end());
     std::sort(sortedRemnantClusters.begin(), sortedRemnantClusters.end(), LArClusterHelper::SortByNHits);
 
+    ExtentVector remnantExtents;
+
+    for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+        remnantExtents.push_back(Extent(pRemnantCluster));
+
+    const ExtentIndex remnantExtentIndex(remnantExtents);
+
     for (const Cluster *const pPfoCluster : sortedPfoClusters)
     {
         try
@@ -111,9 +118,22 @@ void ConeClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, con
                 continue;
             }
 
-            // Bounded fraction calculation
-            for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+            // Bounded fraction calculation, where remnant clusters outside the cone have no bounded hits
+            IndexVector remnantIndices;
+
+            if (m_minBoundedFraction > 0.f)
+            {
+                remnantExtentIndex.GetOverlappingIndices(this->GetConeExtent(showerFitResult.GetShowerFitResult(), minL, maxL, minP, maxP,
+                    minN, maxN), remnantIndices);
+            }
+            else
             {
+                remnantExtentIndex.GetAllIndices(remnantIndices);
+            }
+
+            for (const unsigned int remnantIndex : remnantIndices)
+            {
+                const Cluster *const pRemnantCluster(sortedRemnantClusters.at(remnantIndex));
                 const unsigned int nHits(pRemnantCluster->GetNCaloHits());
 
                 unsigned int nMatchedHits(0);
@@ -162,6 +182,35 @@ void ConeClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, con
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+ClusterMopUpBaseAlgorithm::Extent ConeClusterMopUpAlgorithm::GetConeExtent(const TwoDSlidingFitResult &fitResult, const float minL, const float maxL,
+    const Coordinate &minP, const Coordinate &maxP, const Coordinate &minN, const Coordinate &maxN) const
+{
+    // ATTN The cone is bounded by straight lines in the fit coordinate system, so it lies within the convex hull of these corners
+    float minX(std::numeric_limits<float>::max()), maxX(-std::numeric_limits<float>::max());
+    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (const float rL : {minL, maxL})
+    {
+        const float rTP(minP.second + (rL - minP.first) * ((maxP.second - minP.second) / (maxP.first - minP.first)));
+        const float rTN(minN.second + (rL - minN.first) * ((maxN.second - minN.second) / (maxN.first - minN.first)));
+
+        for (const float rT : {rTP, rTN})
+        {
+            CartesianVector position(0.f, 0.f, 0.f);
+            fitResult.GetGlobalPosition(rL, rT, position);
+
+            minX = std::min(minX, position.GetX());
+            maxX = std::max(maxX, position.GetX());
+            minZ = std::min(minZ, position.GetZ());
+            maxZ = std::max(maxZ, position.GetZ());
+        }
+    }
+
+    return Extent(minX, maxX, minZ, maxZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool ConeClusterMopUpAlgorithm::SortCoordinates(const Coordinate &lhs, const Coordinate &rhs)
 {
     return (lhs.second < rhs.second);
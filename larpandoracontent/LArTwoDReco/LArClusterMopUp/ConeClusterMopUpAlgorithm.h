@@ -42,6 +42,22 @@ private:
      */
     static bool SortCoordinates(const Coordinate &lhs, const Coordinate &rhs);
 
+    /**
+     *  @brief  Get the region of the x-z plane containing the cone, i.e. the bounding box of its corners
+     *
+     *  @param  fitResult the sliding fit result defining the cone coordinate system
+     *  @param  minL the minimum longitudinal coordinate
+     *  @param  maxL the maximum longitudinal coordinate
+     *  @param  minP the coordinate at the start of the positive cone edge
+     *  @param  maxP the coordinate at the end of the positive cone edge
+     *  @param  minN the coordinate at the start of the negative cone edge
+     *  @param  maxN the coordinate at the end of the negative cone edge
+     *
+     *  @return the region
+     */
+    Extent GetConeExtent(const TwoDSlidingFitResult &fitResult, const float minL, const float maxL, const Coordinate &minP, const Coordinate &maxP,
+        const Coordinate &minN, const Coordinate &maxN) const;
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     unsigned int    m_slidingFitWindow;         ///< The layer window for the sliding linear fits
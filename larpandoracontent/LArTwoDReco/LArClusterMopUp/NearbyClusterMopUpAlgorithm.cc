@@ -42,6 +42,25 @@ void NearbyClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, c
     ClusterVector sortedRemnantClusters(remnantClusters.begin(), remnantClusters.end());
     std::sort(sortedRemnantClusters.begin(), sortedRemnantClusters.end(), LArClusterHelper::SortByNHits);
 
+    // ATTN Remnant clusters are only compared with pfo clusters within the minimum separation of their inner or outer centroid
+    ClusterVector candidateRemnantClusters;
+    ExtentVector remnantExtents;
+
+    for (const Cluster *const pClusterR : sortedRemnantClusters)
+    {
+        if (pClusterR->GetNCaloHits() < m_minHitsInCluster)
+            continue;
+
+        const CartesianVector innerCentroidR(pClusterR->GetCentroid(pClusterR->GetInnerPseudoLayer()));
+        const CartesianVector outerCentroidR(pClusterR->GetCentroid(pClusterR->GetOuterPseudoLayer()));
+
+        candidateRemnantClusters.push_back(pClusterR);
+        remnantExtents.push_back(Extent(std::min(innerCentroidR.GetX(), outerCentroidR.GetX()), std::max(innerCentroidR.GetX(), outerCentroidR.GetX()),
+            std::min(innerCentroidR.GetZ(), outerCentroidR.GetZ()), std::max(innerCentroidR.GetZ(), outerCentroidR.GetZ())));
+    }
+
+    const ExtentIndex remnantExtentIndex(remnantExtents);
+
     for (const Cluster *const pClusterP : sortedPfoClusters)
     {
         const HitType hitType(LArClusterHelper::GetClusterHitType(pClusterP));
@@ -51,10 +70,12 @@ void NearbyClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, c
         const float innerPV((vertexPosition2D - pClusterP->GetCentroid(pClusterP->GetInnerPseudoLayer())).GetMagnitude());
         const float outerPV((vertexPosition2D - pClusterP->GetCentroid(pClusterP->GetOuterPseudoLayer())).GetMagnitude());
 
-        for (const Cluster *const pClusterR : sortedRemnantClusters)
+        IndexVector remnantIndices;
+        remnantExtentIndex.GetOverlappingIndices(Extent(pClusterP).GetExpanded(m_minClusterSeparation), remnantIndices);
+
+        for (const unsigned int remnantIndex : remnantIndices)
         {
-            if (pClusterR->GetNCaloHits() < m_minHitsInCluster)
-                continue;
+            const Cluster *const pClusterR(candidateRemnantClusters.at(remnantIndex));
 
             const float innerRV((vertexPosition2D - pClusterR->GetCentroid(pClusterR->GetInnerPseudoLayer())).GetMagnitude());
             const float outerRV((vertexPosition2D - pClusterR->GetCentroid(pClusterR->GetOuterPseudoLayer())).GetMagnitude());
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/ClusterSplittingAlgorithm.h"
 
@@ -17,6 +18,20 @@ using namespace pandora;
 namespace lar_content
 {
 
+ClusterSplittingAlgorithm::ClusterSplittingAlgorithm() :
+    m_nThreads(1)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ClusterSplittingAlgorithm::IsDivisionThreadSafe() const
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterSplittingAlgorithm::Run()
 {
     if (m_inputClusterListNames.empty())
@@ -54,6 +69,13 @@ StatusCode ClusterSplittingAlgorithm::RunUsingCurrentList() const
     const ClusterList *pClusterList = NULL;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pClusterList));
 
+    if (m_nThreads > 1)
+    {
+        ClusterVector clusterVector(pClusterList->begin(), pClusterList->end());
+        std::stable_sort(clusterVector.begin(), clusterVector.end(), LArClusterHelper::SortByNHits);
+        return this->RunUsingCurrentListConcurrently(clusterVector);
+    }
+
     ClusterList internalClusterList(pClusterList->begin(), pClusterList->end());
     internalClusterList.sort(LArClusterHelper::SortByNHits);
 
@@ -74,17 +96,84 @@ StatusCode ClusterSplittingAlgorithm::RunUsingCurrentList() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ClusterSplittingAlgorithm::RunUsingCurrentListConcurrently(const ClusterVector &clusterVector) const
+{
+    // ATTN Fragments are appended to the end of the list in the serial algorithm, so are only reached after all earlier clusters
+    ClusterVector roundClusterVector(clusterVector);
+
+    while (!roundClusterVector.empty())
+    {
+        const std::size_t nClusters(roundClusterVector.size());
+        CaloHitDivisionVector caloHitDivisionVector(nClusters);
+
+        LArParallelHelper::ForEach(nClusters, m_nThreads, [&](const std::size_t iCluster) {
+            CaloHitDivision &caloHitDivision(caloHitDivisionVector.at(iCluster));
+
+            try
+            {
+                caloHitDivision.m_statusCode = this->DivideCaloHits(roundClusterVector.at(iCluster), caloHitDivision.m_firstCaloHitList,
+                    caloHitDivision.m_secondCaloHitList);
+            }
+            catch (...)
+            {
+                caloHitDivision.m_exception = std::current_exception();
+            }
+        });
+
+        ClusterVector nextRoundClusterVector;
+
+        for (std::size_t iCluster = 0; iCluster < nClusters; ++iCluster)
+        {
+            const CaloHitDivision &caloHitDivision(caloHitDivisionVector.at(iCluster));
+
+            if (caloHitDivision.m_exception)
+                std::rethrow_exception(caloHitDivision.m_exception);
+
+            if (STATUS_CODE_SUCCESS != caloHitDivision.m_statusCode)
+                continue;
+
+            ClusterList clusterSplittingList;
+
+            if (STATUS_CODE_SUCCESS != this->FragmentCluster(roundClusterVector.at(iCluster), caloHitDivision.m_firstCaloHitList,
+                caloHitDivision.m_secondCaloHitList, clusterSplittingList))
+            {
+                continue;
+            }
+
+            nextRoundClusterVector.insert(nextRoundClusterVector.end(), clusterSplittingList.begin(), clusterSplittingList.end());
+        }
+
+        roundClusterVector.swap(nextRoundClusterVector);
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterSplittingAlgorithm::SplitCluster(const Cluster *const pCluster, ClusterList &clusterSplittingList) const
 {
     // Split cluster into two CaloHit lists
-    PandoraContentApi::Cluster::Parameters firstParameters, secondParameters;
+    CaloHitList firstCaloHitList, secondCaloHitList;
 
-    if (STATUS_CODE_SUCCESS != this->DivideCaloHits(pCluster, firstParameters.m_caloHitList, secondParameters.m_caloHitList))
+    if (STATUS_CODE_SUCCESS != this->DivideCaloHits(pCluster, firstCaloHitList, secondCaloHitList))
         return STATUS_CODE_NOT_FOUND;
 
-    if (firstParameters.m_caloHitList.empty() || secondParameters.m_caloHitList.empty())
+    return this->FragmentCluster(pCluster, firstCaloHitList, secondCaloHitList, clusterSplittingList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ClusterSplittingAlgorithm::FragmentCluster(const Cluster *const pCluster, const CaloHitList &firstCaloHitList,
+    const CaloHitList &secondCaloHitList, ClusterList &clusterSplittingList) const
+{
+    if (firstCaloHitList.empty() || secondCaloHitList.empty())
         return STATUS_CODE_NOT_ALLOWED;
 
+    PandoraContentApi::Cluster::Parameters firstParameters, secondParameters;
+    firstParameters.m_caloHitList = firstCaloHitList;
+    secondParameters.m_caloHitList = secondCaloHitList;
+
     // Begin cluster fragmentation operations
     const ClusterList clusterList(1, pCluster);
     std::string clusterListToSaveName, clusterListToDeleteName;
@@ -113,7 +202,23 @@ StatusCode ClusterSplittingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadVectorOfValues(xmlHandle,
         "InputClusterListNames", m_inputClusterListNames));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NThreads", m_nThreads));
+
+    if ((m_nThreads > 1) && !this->IsDivisionThreadSafe())
+    {
+        std::cout << "ClusterSplittingAlgorithm: hit division for " << this->GetType() << " does not support NThreads > 1" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ClusterSplittingAlgorithm::CaloHitDivision::CaloHitDivision() :
+    m_statusCode(STATUS_CODE_NOT_FOUND)
+{
+}
+
 } // namespace lar_content
@@ -10,7 +10,9 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <exception>
 #include <list>
+#include <vector>
 
 namespace lar_content
 {
@@ -20,6 +22,12 @@ namespace lar_content
  */
 class ClusterSplittingAlgorithm : public pandora::Algorithm
 {
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ClusterSplittingAlgorithm();
+
 protected:
     virtual pandora::StatusCode Run();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -39,7 +47,42 @@ protected:
     virtual pandora::StatusCode DivideCaloHits(const pandora::Cluster *const pCluster, pandora::CaloHitList &firstCaloHitList,
         pandora::CaloHitList &secondCaloHitList) const = 0;
 
+    /**
+     *  @brief  Whether DivideCaloHits may be called concurrently for different clusters. This requires that it reads only the specified
+     *          cluster and inputs which are not modified by the fragmentation of other clusters, and that it uses no content api calls.
+     *
+     *  @return boolean
+     */
+    virtual bool IsDivisionThreadSafe() const;
+
 private:
+    /**
+     *  @brief  CaloHitDivision class, holding the outcome of the division of the hits in a single cluster
+     */
+    class CaloHitDivision
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        CaloHitDivision();
+
+        pandora::StatusCode     m_statusCode;           ///< The status code returned by DivideCaloHits
+        pandora::CaloHitList    m_firstCaloHitList;     ///< The hits in the first fragment
+        pandora::CaloHitList    m_secondCaloHitList;    ///< The hits in the second fragment
+        std::exception_ptr      m_exception;            ///< Any exception thrown by DivideCaloHits
+    };
+
+    typedef std::vector<CaloHitDivision> CaloHitDivisionVector;
+
+    /**
+     *  @brief  Run the algorithm using the current cluster list as input, dividing the hits in each round of clusters concurrently, then
+     *          applying the fragmentation operations serially, in the order of the serial algorithm. Fragments are divided in later rounds.
+     *
+     *  @param  clusterVector the clusters for the first round, in processing order
+     */
+    pandora::StatusCode RunUsingCurrentListConcurrently(const pandora::ClusterVector &clusterVector) const;
+
     /**
      *  @brief  Split cluster into two fragments
      *
@@ -48,7 +91,19 @@ private:
      */
     pandora::StatusCode SplitCluster(const pandora::Cluster *const pCluster, pandora::ClusterList &clusterSplittingList) const;
 
+    /**
+     *  @brief  Replace a cluster with two fragments holding the specified hits
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  firstCaloHitList the hits in the first fragment
+     *  @param  secondCaloHitList the hits in the second fragment
+     *  @param  clusterSplittingList to receive the two cluster fragments
+     */
+    pandora::StatusCode FragmentCluster(const pandora::Cluster *const pCluster, const pandora::CaloHitList &firstCaloHitList,
+        const pandora::CaloHitList &secondCaloHitList, pandora::ClusterList &clusterSplittingList) const;
+
     pandora::StringVector   m_inputClusterListNames;    ///< The list of input cluster list names - if empty, use the current cluster list
+    unsigned int            m_nThreads;                 ///< The maximum number of threads used to divide cluster hits, serial if below two
 };
 
 } // namespace lar_content
@@ -15,6 +15,8 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <numeric>
+
 using namespace pandora;
 
 namespace lar_content
@@ -24,12 +26,37 @@ CrossedTrackSplittingAlgorithm::CrossedTrackSplittingAlgorithm() :
     m_maxClusterSeparation(2.f),
     m_maxClusterSeparationSquared(m_maxClusterSeparation * m_maxClusterSeparation),
     m_minCosRelativeAngle(0.966f),
-    m_searchRegion1D(2.f)
+    m_searchRegion1D(2.f),
+    m_boundedCandidateSearch(true),
+    m_nPairsConsidered(0),
+    m_nNearbyPairs(0),
+    m_nCandidateSearches(0),
+    m_nCandidatePositions(0)
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CrossedTrackSplittingAlgorithm::Run()
+{
+    m_nPairsConsidered = 0;
+    m_nNearbyPairs = 0;
+    m_nCandidateSearches = 0;
+    m_nCandidatePositions = 0;
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, TwoDSlidingFitSplittingAndSwitchingAlgorithm::Run());
+
+    if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+    {
+        std::cout << "CrossedTrackSplittingAlgorithm: pairs considered " << m_nPairsConsidered << ", nearby pairs " << m_nNearbyPairs
+                  << ", candidate searches " << m_nCandidateSearches << ", candidate positions " << m_nCandidatePositions << std::endl;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CrossedTrackSplittingAlgorithm::PreparationStep(const ClusterVector &clusterVector)
 {
     // ATTN Don't need to update nearby cluster map after cluster merges because algorithm does not revisit processed clusters
@@ -69,6 +96,13 @@ StatusCode CrossedTrackSplittingAlgorithm::PreparationStep(const ClusterVector &
         }
     }
 
+    // ATTN Clusters are unchanged until replaced, after which they are not revisited in this iteration, so the sorted hits remain valid
+    if (m_boundedCandidateSearch)
+    {
+        for (const Cluster *const pCluster : clusterVector)
+            (void) m_sortedHitsMap.emplace(pCluster, SortedHits(pCluster));
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -77,6 +111,7 @@ StatusCode CrossedTrackSplittingAlgorithm::PreparationStep(const ClusterVector &
 StatusCode CrossedTrackSplittingAlgorithm::TidyUpStep()
 {
     m_nearbyClusters.clear();
+    m_sortedHitsMap.clear();
 
     return STATUS_CODE_SUCCESS;
 }
@@ -86,6 +121,8 @@ StatusCode CrossedTrackSplittingAlgorithm::TidyUpStep()
 StatusCode CrossedTrackSplittingAlgorithm::FindBestSplitPosition(const TwoDSlidingFitResult &slidingFitResult1, const TwoDSlidingFitResult &slidingFitResult2,
     CartesianVector &splitPosition, CartesianVector &firstDirection, CartesianVector &secondDirection) const
 {
+    ++m_nPairsConsidered;
+
     // Use cached results from kd-tree to avoid expensive calculations
     if (!m_nearbyClusters.count(slidingFitResult1.GetCluster()) ||
         !m_nearbyClusters.count(slidingFitResult2.GetCluster()) ||
@@ -95,6 +132,8 @@ StatusCode CrossedTrackSplittingAlgorithm::FindBestSplitPosition(const TwoDSlidi
         return STATUS_CODE_NOT_FOUND;
     }
 
+    ++m_nNearbyPairs;
+
     // Identify crossed-track topology and find candidate intersection positions
     const CartesianVector& minPosition1(slidingFitResult1.GetGlobalMinLayerPosition());
     const CartesianVector& maxPosition1(slidingFitResult1.GetGlobalMaxLayerPosition());
@@ -102,19 +141,56 @@ StatusCode CrossedTrackSplittingAlgorithm::FindBestSplitPosition(const TwoDSlidi
     const CartesianVector& minPosition2(slidingFitResult2.GetGlobalMinLayerPosition());
     const CartesianVector& maxPosition2(slidingFitResult2.GetGlobalMaxLayerPosition());
 
-    if (LArClusterHelper::GetClosestDistance(minPosition1, slidingFitResult2.GetCluster()) < 2.f * m_maxClusterSeparation ||
-        LArClusterHelper::GetClosestDistance(maxPosition1, slidingFitResult2.GetCluster()) < 2.f * m_maxClusterSeparation ||
-        LArClusterHelper::GetClosestDistance(minPosition2, slidingFitResult1.GetCluster()) < 2.f * m_maxClusterSeparation ||
-        LArClusterHelper::GetClosestDistance(maxPosition2, slidingFitResult1.GetCluster()) < 2.f * m_maxClusterSeparation)
+    const Cluster *const pCluster1(slidingFitResult1.GetCluster());
+    const Cluster *const pCluster2(slidingFitResult2.GetCluster());
+
+    CartesianPointVector candidateVector;
+
+    if (m_boundedCandidateSearch)
     {
-        return STATUS_CODE_NOT_FOUND;
+        const ClusterToSortedHitsMap::const_iterator sortedHitsIter1(m_sortedHitsMap.find(pCluster1)), sortedHitsIter2(m_sortedHitsMap.find(pCluster2));
+
+        if ((m_sortedHitsMap.end() == sortedHitsIter1) || (m_sortedHitsMap.end() == sortedHitsIter2))
+            throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+        const SortedHits &sortedHits1(sortedHitsIter1->second), &sortedHits2(sortedHitsIter2->second);
+        const float endpointDistance(2.f * m_maxClusterSeparation);
+
+        if (sortedHits2.GetClosestDistance(minPosition1, endpointDistance) < endpointDistance ||
+            sortedHits2.GetClosestDistance(maxPosition1, endpointDistance) < endpointDistance ||
+            sortedHits1.GetClosestDistance(minPosition2, endpointDistance) < endpointDistance ||
+            sortedHits1.GetClosestDistance(maxPosition2, endpointDistance) < endpointDistance)
+        {
+            return STATUS_CODE_NOT_FOUND;
+        }
+
+        ++m_nCandidateSearches;
+
+        // ATTN The closest distance between the clusters is found in the same pass as the candidates, so is checked afterwards
+        float closestDistanceSquared(std::numeric_limits<float>::max());
+        this->FindCandidateSplitPositions(sortedHits1, sortedHits2, candidateVector, closestDistanceSquared);
+
+        if (std::sqrt(closestDistanceSquared) > m_maxClusterSeparation)
+            return STATUS_CODE_NOT_FOUND;
     }
+    else
+    {
+        if (LArClusterHelper::GetClosestDistance(minPosition1, pCluster2) < 2.f * m_maxClusterSeparation ||
+            LArClusterHelper::GetClosestDistance(maxPosition1, pCluster2) < 2.f * m_maxClusterSeparation ||
+            LArClusterHelper::GetClosestDistance(minPosition2, pCluster1) < 2.f * m_maxClusterSeparation ||
+            LArClusterHelper::GetClosestDistance(maxPosition2, pCluster1) < 2.f * m_maxClusterSeparation)
+        {
+            return STATUS_CODE_NOT_FOUND;
+        }
 
-    if (LArClusterHelper::GetClosestDistance(slidingFitResult1.GetCluster(), slidingFitResult2.GetCluster()) > m_maxClusterSeparation)
-        return STATUS_CODE_NOT_FOUND;
+        if (LArClusterHelper::GetClosestDistance(pCluster1, pCluster2) > m_maxClusterSeparation)
+            return STATUS_CODE_NOT_FOUND;
 
-    CartesianPointVector candidateVector;
-    this->FindCandidateSplitPositions(slidingFitResult1.GetCluster(), slidingFitResult2.GetCluster(), candidateVector);
+        ++m_nCandidateSearches;
+        this->FindCandidateSplitPositions(pCluster1, pCluster2, candidateVector);
+    }
+
+    m_nCandidatePositions += candidateVector.size();
 
     if (candidateVector.empty())
         return STATUS_CODE_NOT_FOUND;
@@ -273,6 +349,48 @@ void CrossedTrackSplittingAlgorithm::FindCandidateSplitPositions(const Cluster *
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void CrossedTrackSplittingAlgorithm::FindCandidateSplitPositions(const SortedHits &sortedHits1, const SortedHits &sortedHits2,
+    CartesianPointVector &candidateVector, float &closestDistanceSquared) const
+{
+    // ATTN Hits are visited in the same order as the exhaustive search, so the candidates are identical and in the same order
+    closestDistanceSquared = std::numeric_limits<float>::max();
+
+    for (const CaloHit *const pCaloHit : sortedHits1.GetPositionSortedCaloHits())
+    {
+        float distanceSquared(std::numeric_limits<float>::max());
+        const CaloHit *const pClosestCaloHit(sortedHits2.GetClosestCaloHit(pCaloHit->GetPositionVector(), m_maxClusterSeparation, distanceSquared));
+
+        if (!pClosestCaloHit)
+            continue;
+
+        const CartesianVector position1(pCaloHit->GetPositionVector());
+        const CartesianVector position2(pClosestCaloHit->GetPositionVector());
+        const float separationSquared((position1 - position2).GetMagnitudeSquared());
+
+        closestDistanceSquared = std::min(closestDistanceSquared, separationSquared);
+
+        if (separationSquared < m_maxClusterSeparationSquared)
+            candidateVector.push_back((position1 + position2) * 0.5);
+    }
+
+    for (const CaloHit *const pCaloHit : sortedHits2.GetPositionSortedCaloHits())
+    {
+        float distanceSquared(std::numeric_limits<float>::max());
+        const CaloHit *const pClosestCaloHit(sortedHits1.GetClosestCaloHit(pCaloHit->GetPositionVector(), m_maxClusterSeparation, distanceSquared));
+
+        if (!pClosestCaloHit)
+            continue;
+
+        const CartesianVector position2(pCaloHit->GetPositionVector());
+        const CartesianVector position1(pClosestCaloHit->GetPositionVector());
+
+        if ((position2 - position1).GetMagnitudeSquared() < m_maxClusterSeparationSquared)
+            candidateVector.push_back((position2 + position1) * 0.5);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CrossedTrackSplittingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -285,7 +403,106 @@ StatusCode CrossedTrackSplittingAlgorithm::ReadSettings(const TiXmlHandle xmlHan
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "SearchRegion1D", m_searchRegion1D));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "BoundedCandidateSearch", m_boundedCandidateSearch));
+
     return TwoDSlidingFitSplittingAndSwitchingAlgorithm::ReadSettings(xmlHandle);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CrossedTrackSplittingAlgorithm::SortedHits::SortedHits(const Cluster *const pCluster) :
+    m_isSortedInX(true)
+{
+    CaloHitVector caloHitVector;
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+        caloHitVector.insert(caloHitVector.end(), layerEntry.second->begin(), layerEntry.second->end());
+
+    m_positionSortedCaloHits = caloHitVector;
+    std::sort(m_positionSortedCaloHits.begin(), m_positionSortedCaloHits.end(), LArClusterHelper::SortHitsByPosition);
+
+    // ATTN Sort along the coordinate of larger extent, so that the window excludes as many hits as possible, e.g. for tracks along z
+    float minX(std::numeric_limits<float>::max()), maxX(-std::numeric_limits<float>::max());
+    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (const CaloHit *const pCaloHit : caloHitVector)
+    {
+        const CartesianVector &position(pCaloHit->GetPositionVector());
+        minX = std::min(minX, position.GetX());
+        maxX = std::max(maxX, position.GetX());
+        minZ = std::min(minZ, position.GetZ());
+        maxZ = std::max(maxZ, position.GetZ());
+    }
+
+    m_isSortedInX = (caloHitVector.empty() || ((maxX - minX) >= (maxZ - minZ)));
+
+    FloatVector coordinates;
+    coordinates.reserve(caloHitVector.size());
+
+    for (const CaloHit *const pCaloHit : caloHitVector)
+        coordinates.push_back(this->GetCoordinate(pCaloHit->GetPositionVector()));
+
+    UIntVector order(caloHitVector.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&coordinates](const unsigned int lhs, const unsigned int rhs)
+        {return (coordinates.at(lhs) < coordinates.at(rhs));});
+
+    m_coordinates.reserve(order.size());
+    m_indices.reserve(order.size());
+    m_caloHits.reserve(order.size());
+
+    for (const unsigned int index : order)
+    {
+        m_coordinates.push_back(coordinates.at(index));
+        m_indices.push_back(index);
+        m_caloHits.push_back(caloHitVector.at(index));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CaloHit *CrossedTrackSplittingAlgorithm::SortedHits::GetClosestCaloHit(const CartesianVector &position, const float searchDistance,
+    float &closestDistanceSquared) const
+{
+    // ATTN Window widened slightly, so that rounding cannot exclude a hit within the search distance
+    const float windowHalfWidth(1.01f * searchDistance);
+    const float coordinate(this->GetCoordinate(position));
+    const float maxCoordinate(coordinate + windowHalfWidth);
+
+    const CaloHit *pClosestCaloHit(nullptr);
+    unsigned int closestIndex(std::numeric_limits<unsigned int>::max());
+    closestDistanceSquared = std::numeric_limits<float>::max();
+
+    for (std::size_t i = std::lower_bound(m_coordinates.begin(), m_coordinates.end(), coordinate - windowHalfWidth) - m_coordinates.begin();
+        (i < m_coordinates.size()) && (m_coordinates.at(i) <= maxCoordinate); ++i)
+    {
+        const float distanceSquared((m_caloHits.at(i)->GetPositionVector() - position).GetMagnitudeSquared());
+
+        // ATTN Ties go to the hit earliest in the ordered calo hit list, as in LArClusterHelper::GetClosestPosition
+        if ((distanceSquared < closestDistanceSquared) || (pClosestCaloHit && (distanceSquared == closestDistanceSquared) && (m_indices.at(i) < closestIndex)))
+        {
+            closestDistanceSquared = distanceSquared;
+            closestIndex = m_indices.at(i);
+            pClosestCaloHit = m_caloHits.at(i);
+        }
+    }
+
+    return pClosestCaloHit;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float CrossedTrackSplittingAlgorithm::SortedHits::GetClosestDistance(const CartesianVector &position, const float searchDistance) const
+{
+    float closestDistanceSquared(std::numeric_limits<float>::max());
+    const CaloHit *const pClosestCaloHit(this->GetClosestCaloHit(position, searchDistance, closestDistanceSquared));
+
+    if (!pClosestCaloHit)
+        return std::numeric_limits<float>::max();
+
+    return (position - pClosestCaloHit->GetPositionVector()).GetMagnitude();
+}
+
 } // namespace lar_content
@@ -39,6 +39,71 @@ private:
     typedef std::unordered_map<const pandora::Cluster*, pandora::ClusterSet> ClusterToClustersMap;
     typedef std::unordered_map<const pandora::CaloHit*, const pandora::Cluster*> HitToClusterMap;
 
+    /**
+     *  @brief  SortedHits class, holding the hits of a cluster sorted along the coordinate, x or z, in which the cluster has the larger
+     *          extent, so that closest hit searches can be restricted to a window in that coordinate
+     */
+    class SortedHits
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         */
+        SortedHits(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Get the closest hit to a position, considering only hits within a search distance in the sorting coordinate. If the
+         *          closest hit in the cluster is within the search distance, it is the hit found by LArClusterHelper::GetClosestPosition,
+         *          including for ties.
+         *
+         *  @param  position the position
+         *  @param  searchDistance the search distance
+         *  @param  closestDistanceSquared to receive the distance squared to the closest hit
+         *
+         *  @return address of the closest hit, nullptr if there are no hits within the search window
+         */
+        const pandora::CaloHit *GetClosestCaloHit(const pandora::CartesianVector &position, const float searchDistance,
+            float &closestDistanceSquared) const;
+
+        /**
+         *  @brief  Get the closest distance between a position and the cluster, if it is within a search distance
+         *
+         *  @param  position the position
+         *  @param  searchDistance the search distance
+         *
+         *  @return the closest distance as LArClusterHelper::GetClosestDistance, or the largest float if no hits are within the search window
+         */
+        float GetClosestDistance(const pandora::CartesianVector &position, const float searchDistance) const;
+
+        /**
+         *  @brief  Get the hits of the cluster, sorted by LArClusterHelper::SortHitsByPosition
+         *
+         *  @return the sorted hits
+         */
+        const pandora::CaloHitVector &GetPositionSortedCaloHits() const;
+
+    private:
+        /**
+         *  @brief  Get the coordinate of a position used for sorting
+         *
+         *  @param  position the position
+         *
+         *  @return the x coordinate or the z coordinate
+         */
+        float GetCoordinate(const pandora::CartesianVector &position) const;
+
+        bool                        m_isSortedInX;      ///< Whether the hits are sorted in x, rather than in z
+        pandora::FloatVector        m_coordinates;      ///< The hit coordinates, in increasing order
+        pandora::UIntVector         m_indices;          ///< The index of each hit in the cluster ordered calo hit list
+        pandora::CaloHitVector      m_caloHits;         ///< The hits, in the same order as the coordinates
+        pandora::CaloHitVector      m_positionSortedCaloHits; ///< The hits, sorted by LArClusterHelper::SortHitsByPosition
+    };
+
+    typedef std::unordered_map<const pandora::Cluster*, SortedHits> ClusterToSortedHitsMap;
+
+    pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
     pandora::StatusCode PreparationStep(const pandora::ClusterVector &clusterVector);
     pandora::StatusCode TidyUpStep();
@@ -55,14 +120,46 @@ private:
     void FindCandidateSplitPositions(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2,
         pandora::CartesianPointVector &candidateVector) const;
 
+    /**
+     *  @brief Find average positions of pairs of hits within a maximum separation, searching only a window around each hit
+     *
+     *  @param sortedHits1 the sorted hits of the first cluster
+     *  @param sortedHits2 the sorted hits of the second cluster
+     *  @param candidateVector to receive the average positions
+     *  @param closestDistanceSquared to receive the closest distance squared between the clusters, if within the maximum separation
+     */
+    void FindCandidateSplitPositions(const SortedHits &sortedHits1, const SortedHits &sortedHits2, pandora::CartesianPointVector &candidateVector,
+        float &closestDistanceSquared) const;
+
     float                   m_maxClusterSeparation;             ///< maximum separation of two clusters
     float                   m_maxClusterSeparationSquared;      ///< maximum separation of two clusters (squared)
     float                   m_minCosRelativeAngle;              ///< maximum relative angle between tracks after un-crossing
 
     float                   m_searchRegion1D;                   ///< Search region, applied to each dimension, for look-up from kd-trees
     ClusterToClustersMap    m_nearbyClusters;                   ///< The nearby clusters map
+    ClusterToSortedHitsMap  m_sortedHitsMap;                    ///< The sorted hits of each cluster, for the bounded candidate search
+
+    bool                    m_boundedCandidateSearch;           ///< Whether to restrict closest hit searches to a window around each hit
+    mutable unsigned int    m_nPairsConsidered;                 ///< The number of cluster pairs considered in this event
+    mutable unsigned int    m_nNearbyPairs;                     ///< The number of cluster pairs found to be nearby in the kd-tree
+    mutable unsigned int    m_nCandidateSearches;               ///< The number of cluster pairs searched for candidate split positions
+    mutable unsigned int    m_nCandidatePositions;              ///< The number of candidate split positions found
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CaloHitVector &CrossedTrackSplittingAlgorithm::SortedHits::GetPositionSortedCaloHits() const
+{
+    return m_positionSortedCaloHits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float CrossedTrackSplittingAlgorithm::SortedHits::GetCoordinate(const pandora::CartesianVector &position) const
+{
+    return (m_isSortedInX ? position.GetX() : position.GetZ());
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_CROSSED_TRACK_SPLITTING_ALGORITHM_H
@@ -26,6 +26,7 @@ public:
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+    bool IsDivisionThreadSafe() const;
 
     /**
      *  @brief  Use sliding linear fit to identify the best split position
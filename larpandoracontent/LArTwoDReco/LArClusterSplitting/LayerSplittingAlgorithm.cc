@@ -180,6 +180,13 @@ StatusCode LayerSplittingAlgorithm::DivideCaloHits(const Cluster *const pCluster
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool LayerSplittingAlgorithm::IsDivisionThreadSafe() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode LayerSplittingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -11,6 +11,8 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 
+#include "larpandoracontent/LArObjects/LArSlidingFitCache.h"
+
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/TwoDSlidingFitConsolidationAlgorithm.h"
 
 using namespace pandora;
@@ -85,8 +87,8 @@ void TwoDSlidingFitConsolidationAlgorithm::BuildSlidingLinearFits(const ClusterV
     {
         try
         {
-            const TwoDSlidingFitResult slidingFitResult(*iter, m_halfWindowLayers, slidingFitPitch);
-            slidingFitResultList.push_back(slidingFitResult);
+            const TwoDSlidingFitResultPtr spSlidingFitResult(SlidingFitCache::GetSlidingFitResult(*this, *iter, m_halfWindowLayers, slidingFitPitch));
+            slidingFitResultList.push_back(*spSlidingFitResult);
         }
         catch (StatusCodeException &statusCodeException)
         {
@@ -217,6 +219,15 @@ StatusCode TwoDSlidingFitConsolidationAlgorithm::RebuildClusters(const ClusterTo
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDSlidingFitConsolidationAlgorithm::Reset()
+{
+    SlidingFitCache::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDSlidingFitConsolidationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithm(*this, xmlHandle,
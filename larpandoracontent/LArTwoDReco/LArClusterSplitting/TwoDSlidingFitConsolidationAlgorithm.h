@@ -30,6 +30,7 @@ public:
 
 protected:
     pandora::StatusCode Run();
+    pandora::StatusCode Reset();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     typedef std::unordered_map<const pandora::Cluster*, pandora::CaloHitList> ClusterToHitMap;
@@ -11,6 +11,8 @@
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 
+#include "larpandoracontent/LArObjects/LArSlidingFitCache.h"
+
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/TwoDSlidingFitMultiSplitAlgorithm.h"
 
 using namespace pandora;
@@ -82,9 +84,9 @@ void TwoDSlidingFitMultiSplitAlgorithm::BuildSlidingFitResultMap(const ClusterVe
         {
             try
             {
-                const TwoDSlidingFitResult slidingFitResult(*iter, halfWindowLayers, slidingFitPitch);
+                const TwoDSlidingFitResultPtr spSlidingFitResult(SlidingFitCache::GetSlidingFitResult(*this, *iter, halfWindowLayers, slidingFitPitch));
 
-                if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, slidingFitResult)).second)
+                if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, *spSlidingFitResult)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
             }
             catch (StatusCodeException &statusCodeException)
@@ -209,6 +211,15 @@ StatusCode TwoDSlidingFitMultiSplitAlgorithm::SplitCluster(const TwoDSlidingFitR
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDSlidingFitMultiSplitAlgorithm::Reset()
+{
+    SlidingFitCache::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDSlidingFitMultiSplitAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
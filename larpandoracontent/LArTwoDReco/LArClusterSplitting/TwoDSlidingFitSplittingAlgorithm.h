@@ -27,6 +27,7 @@ public:
     TwoDSlidingFitSplittingAlgorithm();
 
 protected:
+    virtual pandora::StatusCode Reset();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     /**
@@ -11,6 +11,8 @@
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
 
+#include "larpandoracontent/LArObjects/LArSlidingFitCache.h"
+
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/TwoDSlidingFitSplittingAndSplicingAlgorithm.h"
 
 using namespace pandora;
@@ -23,7 +25,10 @@ TwoDSlidingFitSplittingAndSplicingAlgorithm::TwoDSlidingFitSplittingAndSplicingA
     m_longHalfWindowLayers(20),
     m_minClusterLength(7.5f),
     m_vetoDisplacement(1.5f),
-    m_runCosmicMode(false)
+    m_runCosmicMode(false),
+    m_incrementalEvaluation(true),
+    m_nIterations(0),
+    m_nPairTests(0)
 {
 }
 
@@ -31,12 +36,17 @@ TwoDSlidingFitSplittingAndSplicingAlgorithm::TwoDSlidingFitSplittingAndSplicingA
 
 StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::Run()
 {
+    m_nIterations = 0;
+    m_nPairTests = 0;
+
     const ClusterList *pClusterList = NULL;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pClusterList));
 
     TwoDSlidingFitResultMap branchSlidingFitResultMap, replacementSlidingFitResultMap;
+    ClusterPairExtensionMap clusterPairExtensionMap;
+    ClusterSet unchangedClusters;
 
-    unsigned int nIterations(0);
+    unsigned int nIterations(0), nPairTests(0);
 
     while (++nIterations < 100) // Protect against flip-flopping between two answers
     {
@@ -55,18 +65,43 @@ StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::Run()
 
         if (m_runCosmicMode)
         {
-            this->BuildClusterExtensionList(clusterVector, branchSlidingFitResultMap, replacementSlidingFitResultMap, splitList);
+            this->BuildClusterExtensionList(clusterVector, branchSlidingFitResultMap, replacementSlidingFitResultMap, unchangedClusters,
+                clusterPairExtensionMap, splitList, nPairTests);
         }
         else
         {
             ClusterExtensionList intermediateList;
-            this->BuildClusterExtensionList(clusterVector, branchSlidingFitResultMap, replacementSlidingFitResultMap, intermediateList);
+            this->BuildClusterExtensionList(clusterVector, branchSlidingFitResultMap, replacementSlidingFitResultMap, unchangedClusters,
+                clusterPairExtensionMap, intermediateList, nPairTests);
             this->PruneClusterExtensionList(intermediateList, branchSlidingFitResultMap, replacementSlidingFitResultMap, splitList);
         }
 
         // Run splitting and extension
-        if (STATUS_CODE_SUCCESS != this->RunSplitAndExtension(splitList, branchSlidingFitResultMap, replacementSlidingFitResultMap))
+        ClusterSet replacedClusters;
+
+        if (STATUS_CODE_SUCCESS != this->RunSplitAndExtension(splitList, branchSlidingFitResultMap, replacementSlidingFitResultMap, replacedClusters))
             break;
+
+        // ATTN Replaced clusters are excluded by address, as a new cluster may be created at the address of a deleted cluster
+        unchangedClusters.clear();
+
+        if (m_incrementalEvaluation)
+        {
+            for (const Cluster *const pCluster : clusterVector)
+            {
+                if (!replacedClusters.count(pCluster))
+                    (void) unchangedClusters.insert(pCluster);
+            }
+        }
+    }
+
+    m_nIterations = nIterations;
+    m_nPairTests = nPairTests;
+
+    if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+    {
+        std::cout << "TwoDSlidingFitSplittingAndSplicingAlgorithm: " << this->GetType() << " (" << this->GetInstanceName() << "), iterations "
+                  << m_nIterations << ", pair tests " << m_nPairTests << std::endl;
     }
 
     return STATUS_CODE_SUCCESS;
@@ -102,9 +137,9 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildSlidingFitResultMap(const
         {
             try
             {
-                const TwoDSlidingFitResult slidingFitResult(*iter, halfWindowLayers, slidingFitPitch);
+                const TwoDSlidingFitResultPtr spSlidingFitResult(SlidingFitCache::GetSlidingFitResult(*this, *iter, halfWindowLayers, slidingFitPitch));
 
-                if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, slidingFitResult)).second)
+                if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, *spSlidingFitResult)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
             }
             catch (StatusCodeException &statusCodeException)
@@ -120,12 +155,16 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildSlidingFitResultMap(const
 
 void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildClusterExtensionList(const ClusterVector &clusterVector,
     const TwoDSlidingFitResultMap &branchSlidingFitResultMap, const TwoDSlidingFitResultMap &replacementSlidingFitResultMap,
-    ClusterExtensionList &clusterExtensionList) const
+    const ClusterSet &unchangedClusters, ClusterPairExtensionMap &clusterPairExtensionMap, ClusterExtensionList &clusterExtensionList,
+    unsigned int &nPairTests) const
 {
+    ClusterPairExtensionMap newClusterPairExtensionMap;
+
     // Loop over each possible pair of clusters
     for (ClusterVector::const_iterator iterI = clusterVector.begin(), iterEndI = clusterVector.end(); iterI != iterEndI; ++iterI)
     {
         const Cluster *const pClusterI = *iterI;
+        const bool isUnchangedI(unchangedClusters.count(pClusterI) > 0);
 
         for (ClusterVector::const_iterator iterJ = iterI, iterEndJ = clusterVector.end(); iterJ != iterEndJ; ++iterJ)
         {
@@ -134,88 +173,120 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildClusterExtensionList(cons
             if (pClusterI == pClusterJ)
                 continue;
 
-            // Get the branch and replacement sliding fits for this pair of clusters
-            TwoDSlidingFitResultMap::const_iterator iterBranchI = branchSlidingFitResultMap.find(*iterI);
-            TwoDSlidingFitResultMap::const_iterator iterBranchJ = branchSlidingFitResultMap.find(*iterJ);
+            // ATTN Pairs are keyed independently of the cluster ordering, which need not be stable for clusters with equal sort properties
+            const ClusterPair clusterPair(std::min(pClusterI, pClusterJ), std::max(pClusterI, pClusterJ));
+            ClusterExtensionList pairExtensionList;
 
-            TwoDSlidingFitResultMap::const_iterator iterReplacementI = replacementSlidingFitResultMap.find(*iterI);
-            TwoDSlidingFitResultMap::const_iterator iterReplacementJ = replacementSlidingFitResultMap.find(*iterJ);
+            if (isUnchangedI && unchangedClusters.count(pClusterJ))
+            {
+                ClusterPairExtensionMap::const_iterator pairIter(clusterPairExtensionMap.find(clusterPair));
 
-            if (branchSlidingFitResultMap.end() == iterBranchI || branchSlidingFitResultMap.end() == iterBranchJ ||
-                replacementSlidingFitResultMap.end() == iterReplacementI || replacementSlidingFitResultMap.end() == iterReplacementJ)
+                if (clusterPairExtensionMap.end() != pairIter)
+                    pairExtensionList.push_back(pairIter->second);
+            }
+            else
             {
-                // TODO May want to raise an exception under certain conditions
-                continue;
+                ++nPairTests;
+                this->BuildClusterExtension(pClusterI, pClusterJ, branchSlidingFitResultMap, replacementSlidingFitResultMap, pairExtensionList);
+            }
+
+            for (const ClusterExtension &clusterExtension : pairExtensionList)
+            {
+                clusterExtensionList.push_back(clusterExtension);
+                (void) newClusterPairExtensionMap.insert(ClusterPairExtensionMap::value_type(clusterPair, clusterExtension));
             }
+        }
+    }
 
-            const TwoDSlidingFitResult &branchSlidingFitI(iterBranchI->second);
-            const TwoDSlidingFitResult &branchSlidingFitJ(iterBranchJ->second);
+    clusterPairExtensionMap.swap(newClusterPairExtensionMap);
+}
 
-            const TwoDSlidingFitResult &replacementSlidingFitI(iterReplacementI->second);
-            const TwoDSlidingFitResult &replacementSlidingFitJ(iterReplacementJ->second);
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-            // Search for a split in clusterI
-            float branchChisqI(0.f);
-            CartesianVector branchSplitPositionI(0.f, 0.f, 0.f);
-            CartesianVector branchSplitDirectionI(0.f, 0.f, 0.f);
-            CartesianVector replacementStartPositionJ(0.f, 0.f, 0.f);
+void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildClusterExtension(const Cluster *const pClusterI, const Cluster *const pClusterJ,
+    const TwoDSlidingFitResultMap &branchSlidingFitResultMap, const TwoDSlidingFitResultMap &replacementSlidingFitResultMap,
+    ClusterExtensionList &clusterExtensionList) const
+{
+    // Get the branch and replacement sliding fits for this pair of clusters
+    TwoDSlidingFitResultMap::const_iterator iterBranchI = branchSlidingFitResultMap.find(pClusterI);
+    TwoDSlidingFitResultMap::const_iterator iterBranchJ = branchSlidingFitResultMap.find(pClusterJ);
 
-            try
-            {
-                this->FindBestSplitPosition(branchSlidingFitI, replacementSlidingFitJ, replacementStartPositionJ, branchSplitPositionI, branchSplitDirectionI);
-                branchChisqI = this->CalculateBranchChi2(pClusterI, branchSplitPositionI, branchSplitDirectionI);
-            }
-            catch (StatusCodeException &)
-            {
-            }
+    TwoDSlidingFitResultMap::const_iterator iterReplacementI = replacementSlidingFitResultMap.find(pClusterI);
+    TwoDSlidingFitResultMap::const_iterator iterReplacementJ = replacementSlidingFitResultMap.find(pClusterJ);
+
+    if (branchSlidingFitResultMap.end() == iterBranchI || branchSlidingFitResultMap.end() == iterBranchJ ||
+        replacementSlidingFitResultMap.end() == iterReplacementI || replacementSlidingFitResultMap.end() == iterReplacementJ)
+    {
+        // TODO May want to raise an exception under certain conditions
+        return;
+    }
+
+    const TwoDSlidingFitResult &branchSlidingFitI(iterBranchI->second);
+    const TwoDSlidingFitResult &branchSlidingFitJ(iterBranchJ->second);
 
-            // Search for a split in clusterJ
-            float branchChisqJ(0.f);
-            CartesianVector branchSplitPositionJ(0.f, 0.f, 0.f);
-            CartesianVector branchSplitDirectionJ(0.f, 0.f, 0.f);
-            CartesianVector replacementStartPositionI(0.f, 0.f, 0.f);
+    const TwoDSlidingFitResult &replacementSlidingFitI(iterReplacementI->second);
+    const TwoDSlidingFitResult &replacementSlidingFitJ(iterReplacementJ->second);
 
+    // Search for a split in clusterI
+    float branchChisqI(0.f);
+    CartesianVector branchSplitPositionI(0.f, 0.f, 0.f);
+    CartesianVector branchSplitDirectionI(0.f, 0.f, 0.f);
+    CartesianVector replacementStartPositionJ(0.f, 0.f, 0.f);
+
+    try
+    {
+        this->FindBestSplitPosition(branchSlidingFitI, replacementSlidingFitJ, replacementStartPositionJ, branchSplitPositionI, branchSplitDirectionI);
+        branchChisqI = this->CalculateBranchChi2(pClusterI, branchSplitPositionI, branchSplitDirectionI);
+    }
+    catch (StatusCodeException &)
+    {
+    }
+
+    // Search for a split in clusterJ
+    float branchChisqJ(0.f);
+    CartesianVector branchSplitPositionJ(0.f, 0.f, 0.f);
+    CartesianVector branchSplitDirectionJ(0.f, 0.f, 0.f);
+    CartesianVector replacementStartPositionI(0.f, 0.f, 0.f);
+
+    try
+    {
+        this->FindBestSplitPosition(branchSlidingFitJ, replacementSlidingFitI, replacementStartPositionI, branchSplitPositionJ, branchSplitDirectionJ);
+        branchChisqJ = this->CalculateBranchChi2(pClusterJ, branchSplitPositionJ, branchSplitDirectionJ);
+    }
+    catch (StatusCodeException &)
+    {
+    }
+
+    // Re-calculate chi2 values if both clusters have a split
+    if (branchChisqI > 0.f && branchChisqJ > 0.f)
+    {
+        const CartesianVector relativeDirection((branchSplitPositionJ - branchSplitPositionI).GetUnitVector());
+
+        if (branchSplitDirectionI.GetDotProduct(relativeDirection) > 0.f &&
+            branchSplitDirectionJ.GetDotProduct(relativeDirection) < 0.f )
+        {
             try
             {
-                this->FindBestSplitPosition(branchSlidingFitJ, replacementSlidingFitI, replacementStartPositionI, branchSplitPositionJ, branchSplitDirectionJ);
-                branchChisqJ = this->CalculateBranchChi2(pClusterJ, branchSplitPositionJ, branchSplitDirectionJ);
+                const float newBranchChisqI(this->CalculateBranchChi2(pClusterI, branchSplitPositionI, relativeDirection));
+                const float newBranchChisqJ(this->CalculateBranchChi2(pClusterJ, branchSplitPositionJ, relativeDirection * -1.f));
+                branchChisqI = newBranchChisqI;
+                branchChisqJ = newBranchChisqJ;
             }
             catch (StatusCodeException &)
             {
             }
+        }
+    }
 
-            // Re-calculate chi2 values if both clusters have a split
-            if (branchChisqI > 0.f && branchChisqJ > 0.f)
-            {
-                const CartesianVector relativeDirection((branchSplitPositionJ - branchSplitPositionI).GetUnitVector());
-
-                if (branchSplitDirectionI.GetDotProduct(relativeDirection) > 0.f &&
-                    branchSplitDirectionJ.GetDotProduct(relativeDirection) < 0.f )
-                {
-                    try
-                    {
-                        const float newBranchChisqI(this->CalculateBranchChi2(pClusterI, branchSplitPositionI, relativeDirection));
-                        const float newBranchChisqJ(this->CalculateBranchChi2(pClusterJ, branchSplitPositionJ, relativeDirection * -1.f));
-                        branchChisqI = newBranchChisqI;
-                        branchChisqJ = newBranchChisqJ;
-                    }
-                    catch (StatusCodeException &)
-                    {
-                    }
-                }
-            }
-
-            // Select the overall best split position
-            if (branchChisqI > branchChisqJ)
-            {
-                clusterExtensionList.push_back(ClusterExtension(pClusterI, pClusterJ, replacementStartPositionJ, branchSplitPositionI, branchSplitDirectionI));
-            }
+    // Select the overall best split position
+    if (branchChisqI > branchChisqJ)
+    {
+        clusterExtensionList.push_back(ClusterExtension(pClusterI, pClusterJ, replacementStartPositionJ, branchSplitPositionI, branchSplitDirectionI));
+    }
 
-            else if (branchChisqJ > branchChisqI)
-            {
-                clusterExtensionList.push_back(ClusterExtension(pClusterJ, pClusterI, replacementStartPositionI, branchSplitPositionJ, branchSplitDirectionJ));
-            }
-        }
+    else if (branchChisqJ > branchChisqI)
+    {
+        clusterExtensionList.push_back(ClusterExtension(pClusterJ, pClusterI, replacementStartPositionI, branchSplitPositionJ, branchSplitDirectionJ));
     }
 }
 
@@ -344,7 +415,7 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::SplitBranchCluster(const Clust
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::RunSplitAndExtension(const ClusterExtensionList &splitList,
-    TwoDSlidingFitResultMap &branchResultMap, TwoDSlidingFitResultMap &replacementResultMap) const
+    TwoDSlidingFitResultMap &branchResultMap, TwoDSlidingFitResultMap &replacementResultMap, ClusterSet &replacedClusters) const
 {
     bool foundSplit(false);
 
@@ -375,6 +446,9 @@ StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::RunSplitAndExtension(con
         replacementResultMap.erase(iterReplacement1);
         replacementResultMap.erase(iterReplacement2);
 
+        (void) replacedClusters.insert(pBranchCluster);
+        (void) replacedClusters.insert(pReplacementCluster);
+
         foundSplit = true;
     }
 
@@ -415,6 +489,15 @@ StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::ReplaceBranch(const Clus
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::Reset()
+{
+    SlidingFitCache::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -432,6 +515,9 @@ StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::ReadSettings(const TiXml
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "CosmicMode", m_runCosmicMode));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "IncrementalEvaluation", m_incrementalEvaluation));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -26,8 +26,23 @@ public:
      */
     TwoDSlidingFitSplittingAndSplicingAlgorithm();
 
+    /**
+     *  @brief  Get the number of iterations made in the last call to Run
+     *
+     *  @return the number of iterations
+     */
+    unsigned int GetNIterations() const;
+
+    /**
+     *  @brief  Get the number of cluster pairs examined in the last call to Run
+     *
+     *  @return the number of pair tests
+     */
+    unsigned int GetNPairTests() const;
+
 protected:
     virtual pandora::StatusCode Run();
+    virtual pandora::StatusCode Reset();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     /**
@@ -83,6 +98,8 @@ protected:
     };
 
     typedef std::vector<ClusterExtension> ClusterExtensionList;
+    typedef std::pair<const pandora::Cluster*, const pandora::Cluster*> ClusterPair;
+    typedef std::map<ClusterPair, ClusterExtension> ClusterPairExtensionMap;
 
     /**
      *  @brief  Output the best split positions in branch and replacement clusters
@@ -118,15 +135,34 @@ private:
         TwoDSlidingFitResultMap &slidingFitResultMap) const;
 
     /**
-     *  @brief  Build a list of candidate splits
+     *  @brief  Build a list of candidate splits. The candidate split for a pair of unchanged clusters, which depends only on the two
+     *          clusters, is taken from the previous iteration rather than re-examined.
      *
      *  @param  clusterVector the input cluster vector
      *  @param  branchResultMap the sliding fit result map for branch clusters
      *  @param  replacementResultMap the sliding fit result map for replacement clusters
+     *  @param  unchangedClusters the clusters examined in the previous iteration and not replaced since
+     *  @param  clusterPairExtensionMap the candidate splits for pairs of clusters in the previous iteration, to be replaced by those for
+     *          this iteration
      *  @param  clusterExtensionList the output list of candidate splits
+     *  @param  nPairTests to receive the incremented number of cluster pairs examined
      */
     void BuildClusterExtensionList(const pandora::ClusterVector &clusterVector, const TwoDSlidingFitResultMap &branchResultMap,
-        const TwoDSlidingFitResultMap &replacementResultMap, ClusterExtensionList &clusterExtensionList) const;
+        const TwoDSlidingFitResultMap &replacementResultMap, const pandora::ClusterSet &unchangedClusters,
+        ClusterPairExtensionMap &clusterPairExtensionMap, ClusterExtensionList &clusterExtensionList, unsigned int &nPairTests) const;
+
+    /**
+     *  @brief  Examine a pair of clusters for a candidate split
+     *
+     *  @param  pClusterI address of the first cluster
+     *  @param  pClusterJ address of the second cluster
+     *  @param  branchResultMap the sliding fit result map for branch clusters
+     *  @param  replacementResultMap the sliding fit result map for replacement clusters
+     *  @param  clusterExtensionList to receive the candidate split, if any
+     */
+    void BuildClusterExtension(const pandora::Cluster *const pClusterI, const pandora::Cluster *const pClusterJ,
+        const TwoDSlidingFitResultMap &branchResultMap, const TwoDSlidingFitResultMap &replacementResultMap,
+        ClusterExtensionList &clusterExtensionList) const;
 
     /**
      *  @brief  Finalize the list of candidate splits
@@ -168,9 +204,10 @@ private:
      *  @param  splitList the input list of candidate splits
      *  @param  branchResultMap the sliding fit result map for branch clusters
      *  @param  replacementResultMap the sliding fit result map for replacement clusters
+     *  @param  replacedClusters to receive the clusters deleted by the splits
      */
     pandora::StatusCode RunSplitAndExtension(const ClusterExtensionList &splitList, TwoDSlidingFitResultMap &branchResultMap,
-        TwoDSlidingFitResultMap &replacementResultMap) const;
+        TwoDSlidingFitResultMap &replacementResultMap, pandora::ClusterSet &replacedClusters) const;
 
    /**
      *  @brief  Remove a branch from a cluster and replace it with a second cluster
@@ -188,6 +225,9 @@ private:
     float         m_minClusterLength;               ///<
     float         m_vetoDisplacement;               ///<
     bool          m_runCosmicMode;                  ///<
+    bool          m_incrementalEvaluation;          ///< Whether to only re-examine cluster pairs including a cluster created since the previous iteration
+    unsigned int  m_nIterations;                    ///< The number of iterations made in the last call to Run
+    unsigned int  m_nPairTests;                     ///< The number of cluster pairs examined in the last call to Run
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -240,6 +280,20 @@ inline const pandora::CartesianVector &TwoDSlidingFitSplittingAndSplicingAlgorit
     return m_branchDirection;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int TwoDSlidingFitSplittingAndSplicingAlgorithm::GetNIterations() const
+{
+    return m_nIterations;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int TwoDSlidingFitSplittingAndSplicingAlgorithm::GetNPairTests() const
+{
+    return m_nPairTests;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_TWO_D_SLIDING_FIT_SPLITTING_AND_SPLICING_ALGORITHM_H
@@ -11,6 +11,8 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 
+#include "larpandoracontent/LArObjects/LArSlidingFitCache.h"
+
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/TwoDSlidingFitSplittingAndSwitchingAlgorithm.h"
 
 using namespace pandora;
@@ -20,7 +22,11 @@ namespace lar_content
 
 TwoDSlidingFitSplittingAndSwitchingAlgorithm::TwoDSlidingFitSplittingAndSwitchingAlgorithm() :
     m_halfWindowLayers(25),
-    m_minClusterLength(10.f)
+    m_minClusterLength(10.f),
+    m_maxIterations(1),
+    m_incrementalEvaluation(true),
+    m_nIterations(0),
+    m_nPairTests(0)
 {
 }
 
@@ -28,72 +34,120 @@ TwoDSlidingFitSplittingAndSwitchingAlgorithm::TwoDSlidingFitSplittingAndSwitchin
 
 StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::Run()
 {
+    m_nIterations = 0;
+    m_nPairTests = 0;
+
     const ClusterList *pClusterList = NULL;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pClusterList));
 
-    // Get ordered list of clean clusters
-    ClusterVector clusterVector;
-    this->GetListOfCleanClusters(pClusterList, clusterVector);
-
-    // Calculate sliding fit results for clean clusters
-    TwoDSlidingFitResultMap slidingFitResultMap;
-    this->BuildSlidingFitResultMap(clusterVector, slidingFitResultMap);
+    ClusterSet unchangedClusters;
+    unsigned int nIterations(0), nPairTests(0);
 
-    // May choose to cache information here, for subsequent expensive calculations
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PreparationStep(clusterVector));
-
-    // Loop over clusters, identify split positions, perform splits
-    for (ClusterVector::iterator iter1 = clusterVector.begin(), iterEnd1 = clusterVector.end(); iter1 != iterEnd1; ++iter1)
+    while (nIterations++ < m_maxIterations)
     {
-        if (NULL == *iter1)
-            continue;
+        // Get ordered list of clean clusters
+        ClusterVector clusterVector;
+        this->GetListOfCleanClusters(pClusterList, clusterVector);
 
-        TwoDSlidingFitResultMap::iterator sIter1 = slidingFitResultMap.find(*iter1);
+        // Calculate sliding fit results for clean clusters
+        TwoDSlidingFitResultMap slidingFitResultMap;
+        this->BuildSlidingFitResultMap(clusterVector, slidingFitResultMap);
 
-        if (slidingFitResultMap.end() == sIter1)
-            continue;
+        // May choose to cache information here, for subsequent expensive calculations
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PreparationStep(clusterVector));
 
-        const TwoDSlidingFitResult &slidingFitResult1(sIter1->second);
+        // Loop over clusters, identify split positions, perform splits
+        const ClusterVector originalClusterVector(clusterVector);
+        ClusterSet replacedClusters;
 
-        for (ClusterVector::iterator iter2 = iter1, iterEnd2 = iterEnd1; iter2 != iterEnd2; ++iter2)
+        for (ClusterVector::iterator iter1 = clusterVector.begin(), iterEnd1 = clusterVector.end(); iter1 != iterEnd1; ++iter1)
         {
-            if (NULL == *iter2)
+            if (NULL == *iter1)
                 continue;
 
-            TwoDSlidingFitResultMap::iterator sIter2 = slidingFitResultMap.find(*iter2);
+            TwoDSlidingFitResultMap::iterator sIter1 = slidingFitResultMap.find(*iter1);
 
-            if (slidingFitResultMap.end() == sIter2)
+            if (slidingFitResultMap.end() == sIter1)
                 continue;
 
-            const TwoDSlidingFitResult &slidingFitResult2(sIter2->second);
+            const TwoDSlidingFitResult &slidingFitResult1(sIter1->second);
+            const bool isUnchanged1(unchangedClusters.count(*iter1) > 0);
 
-            if (slidingFitResult1.GetCluster() == slidingFitResult2.GetCluster())
-                continue;
+            for (ClusterVector::iterator iter2 = iter1, iterEnd2 = iterEnd1; iter2 != iterEnd2; ++iter2)
+            {
+                if (NULL == *iter2)
+                    continue;
 
-            CartesianVector splitPosition(0.f,0.f,0.f);
-            CartesianVector firstDirection(0.f,0.f,0.f);
-            CartesianVector secondDirection(0.f,0.f,0.f);
+                // ATTN Both clusters were examined together in the previous iteration, without a successful split
+                if (isUnchanged1 && unchangedClusters.count(*iter2))
+                    continue;
 
-            if (STATUS_CODE_SUCCESS != this->FindBestSplitPosition(slidingFitResult1, slidingFitResult2, splitPosition, firstDirection, secondDirection))
-                continue;
+                TwoDSlidingFitResultMap::iterator sIter2 = slidingFitResultMap.find(*iter2);
 
-            const Cluster *const pCluster1 = slidingFitResult1.GetCluster();
-            const Cluster *const pCluster2 = slidingFitResult2.GetCluster();
+                if (slidingFitResultMap.end() == sIter2)
+                    continue;
 
-            if (STATUS_CODE_SUCCESS != this->ReplaceClusters(pCluster1, pCluster2, splitPosition, firstDirection, secondDirection))
-                continue;
+                const TwoDSlidingFitResult &slidingFitResult2(sIter2->second);
+
+                if (slidingFitResult1.GetCluster() == slidingFitResult2.GetCluster())
+                    continue;
 
-            slidingFitResultMap.erase(sIter1);
-            slidingFitResultMap.erase(sIter2);
+                ++nPairTests;
+
+                CartesianVector splitPosition(0.f,0.f,0.f);
+                CartesianVector firstDirection(0.f,0.f,0.f);
+                CartesianVector secondDirection(0.f,0.f,0.f);
+
+                if (STATUS_CODE_SUCCESS != this->FindBestSplitPosition(slidingFitResult1, slidingFitResult2, splitPosition, firstDirection, secondDirection))
+                    continue;
+
+                const Cluster *const pCluster1 = slidingFitResult1.GetCluster();
+                const Cluster *const pCluster2 = slidingFitResult2.GetCluster();
+
+                if (STATUS_CODE_SUCCESS != this->ReplaceClusters(pCluster1, pCluster2, splitPosition, firstDirection, secondDirection))
+                    continue;
+
+                (void) replacedClusters.insert(pCluster1);
+                (void) replacedClusters.insert(pCluster2);
+
+                slidingFitResultMap.erase(sIter1);
+                slidingFitResultMap.erase(sIter2);
+
+                *iter1 = NULL;
+                *iter2 = NULL;
+
+                break;
+            }
+        }
 
-            *iter1 = NULL;
-            *iter2 = NULL;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->TidyUpStep());
 
+        if (replacedClusters.empty())
             break;
+
+        // ATTN Replaced clusters are excluded by address, as a new cluster may be created at the address of a deleted cluster
+        unchangedClusters.clear();
+
+        if (m_incrementalEvaluation)
+        {
+            for (const Cluster *const pCluster : originalClusterVector)
+            {
+                if (!replacedClusters.count(pCluster))
+                    (void) unchangedClusters.insert(pCluster);
+            }
         }
     }
 
-    return this->TidyUpStep();
+    m_nIterations = std::min(nIterations, m_maxIterations);
+    m_nPairTests = nPairTests;
+
+    if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+    {
+        std::cout << "TwoDSlidingFitSplittingAndSwitchingAlgorithm: " << this->GetType() << " (" << this->GetInstanceName() << "), iterations "
+                  << m_nIterations << ", pair tests " << m_nPairTests << std::endl;
+    }
+
+    return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -140,9 +194,9 @@ void TwoDSlidingFitSplittingAndSwitchingAlgorithm::BuildSlidingFitResultMap(cons
         {
             try
             {
-                const TwoDSlidingFitResult slidingFitResult(*iter, m_halfWindowLayers, slidingFitPitch);
+                const TwoDSlidingFitResultPtr spSlidingFitResult(SlidingFitCache::GetSlidingFitResult(*this, *iter, m_halfWindowLayers, slidingFitPitch));
 
-                if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, slidingFitResult)).second)
+                if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, *spSlidingFitResult)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
             }
             catch (StatusCodeException &statusCodeException)
@@ -213,6 +267,15 @@ StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::ReplaceClusters(const C
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::Reset()
+{
+    SlidingFitCache::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -221,6 +284,12 @@ StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::ReadSettings(const TiXm
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "MinClusterLength", m_minClusterLength));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "MaxIterations", m_maxIterations));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "IncrementalEvaluation", m_incrementalEvaluation));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -26,8 +26,23 @@ public:
      */
     TwoDSlidingFitSplittingAndSwitchingAlgorithm();
 
+    /**
+     *  @brief  Get the number of iterations made in the last call to Run
+     *
+     *  @return the number of iterations
+     */
+    unsigned int GetNIterations() const;
+
+    /**
+     *  @brief  Get the number of cluster pairs examined in the last call to Run
+     *
+     *  @return the number of pair tests
+     */
+    unsigned int GetNPairTests() const;
+
 protected:
     virtual pandora::StatusCode Run();
+    virtual pandora::StatusCode Reset();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     /**
@@ -97,10 +112,28 @@ private:
         const pandora::CartesianVector &splitPosition, const pandora::CartesianVector &firstDirection,
         const pandora::CartesianVector &secondDirection) const;
 
-    unsigned int  m_halfWindowLayers;     ///< half window layers for sliding linear fot
-    float         m_minClusterLength;     ///< minimum length of clusters
+    unsigned int  m_halfWindowLayers;       ///< half window layers for sliding linear fot
+    float         m_minClusterLength;       ///< minimum length of clusters
+    unsigned int  m_maxIterations;          ///< maximum number of passes over the clusters, each examining clusters created by the last pass
+    bool          m_incrementalEvaluation;  ///< whether to only re-examine cluster pairs including a cluster created by the last pass
+    unsigned int  m_nIterations;            ///< the number of iterations made in the last call to Run
+    unsigned int  m_nPairTests;             ///< the number of cluster pairs examined in the last call to Run
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int TwoDSlidingFitSplittingAndSwitchingAlgorithm::GetNIterations() const
+{
+    return m_nIterations;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int TwoDSlidingFitSplittingAndSwitchingAlgorithm::GetNPairTests() const
+{
+    return m_nPairTests;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_TWO_D_SLIDING_FIT_SPLITTING_AND_SWITCHING_ALGORITHM_H
@@ -155,8 +155,8 @@ std::pair<float,float> minmax(const float a, const float b);
  *
  *  @return KDTreeCube
  */
-template<typename T>
-KDTreeBox fill_and_bound_2d_kd_tree(const MANAGED_CONTAINER<const T*> &points, std::vector<KDTreeNodeInfoT<const T*, 2> > &nodes);
+template<typename T, typename CONTAINER>
+KDTreeBox fill_and_bound_2d_kd_tree(const CONTAINER &points, std::vector<KDTreeNodeInfoT<const T*, 2> > &nodes);
 
 /**
  *  @brief  fill_and_bound_3d_kd_tree
@@ -307,8 +307,8 @@ inline const pandora::CartesianVector &kdtree_type_adaptor<const pandora::Cartes
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-template<typename T>
-KDTreeBox fill_and_bound_2d_kd_tree(const MANAGED_CONTAINER<const T*> &points, std::vector<KDTreeNodeInfoT<const T*, 2> > &nodes)
+template<typename T, typename CONTAINER>
+KDTreeBox fill_and_bound_2d_kd_tree(const CONTAINER &points, std::vector<KDTreeNodeInfoT<const T*, 2> > &nodes)
 {
     std::array<float, 2> minpos{ {0.f, 0.f} }, maxpos{ {0.f, 0.f} };
 
@@ -17,6 +17,14 @@ using namespace pandora;
 namespace lar_content
 {
 
+PfoMopUpBaseAlgorithm::PfoMopUpBaseAlgorithm() :
+    m_incrementalMopUp(true),
+    m_hasEventState(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void PfoMopUpBaseAlgorithm::MergeAndDeletePfos(const ParticleFlowObject *const pPfoToEnlarge, const ParticleFlowObject *const pPfoToDelete) const
 {
     if (pPfoToEnlarge == pPfoToDelete)
@@ -81,8 +89,91 @@ const Cluster *PfoMopUpBaseAlgorithm::GetParentCluster(const ClusterList &cluste
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void PfoMopUpBaseAlgorithm::GetUnchangedPfos(PfoSet &unchangedPfos) const
+{
+    if (!m_incrementalMopUp || !m_hasEventState)
+        return;
+
+    EventState eventState;
+    this->GetEventState(eventState);
+
+    if (m_eventState.m_vertexVector != eventState.m_vertexVector)
+        return;
+
+    for (const PfoStateMap::value_type &mapEntry : eventState.m_pfoStateMap)
+    {
+        const PfoStateMap::const_iterator previousIter(m_eventState.m_pfoStateMap.find(mapEntry.first));
+
+        if ((m_eventState.m_pfoStateMap.end() != previousIter) && (previousIter->second == mapEntry.second))
+            unchangedPfos.insert(mapEntry.first);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoMopUpBaseAlgorithm::RecordEventState(const bool isConverged)
+{
+    m_hasEventState = false;
+    m_eventState = EventState();
+
+    if (!m_incrementalMopUp || !isConverged)
+        return;
+
+    this->GetEventState(m_eventState);
+    m_hasEventState = true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoMopUpBaseAlgorithm::GetEventState(EventState &eventState) const
+{
+    const VertexList *pVertexList(nullptr);
+    PANDORA_THROW_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=, PandoraContentApi::GetCurrentList(*this, pVertexList));
+
+    if (pVertexList)
+        eventState.m_vertexVector.insert(eventState.m_vertexVector.end(), pVertexList->begin(), pVertexList->end());
+
+    for (unsigned int iList = 0; iList < m_daughterListNames.size(); ++iList)
+    {
+        const PfoList *pPfoList(nullptr);
+        if (STATUS_CODE_SUCCESS != PandoraContentApi::GetList(*this, m_daughterListNames.at(iList), pPfoList))
+            continue;
+
+        for (const ParticleFlowObject *const pPfo : *pPfoList)
+        {
+            PfoState pfoState;
+            pfoState.m_listIndex = iList;
+            pfoState.m_particleId = pPfo->GetParticleId();
+
+            const PropertiesMap &pfoMeta(pPfo->GetPropertiesMap());
+            const auto &trackScoreIter(pfoMeta.find("TrackScore"));
+            pfoState.m_trackScore = (trackScoreIter != pfoMeta.end() ? trackScoreIter->second : -1.f);
+
+            for (const Cluster *const pCluster : pPfo->GetClusterList())
+                pfoState.m_clusterStates.emplace_back(pCluster, pCluster->GetNCaloHits());
+
+            eventState.m_pfoStateMap.emplace(pPfo, std::move(pfoState));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PfoMopUpBaseAlgorithm::Reset()
+{
+    m_hasEventState = false;
+    m_eventState = EventState();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PfoMopUpBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "IncrementalMopUp", m_incrementalMopUp));
+
     return MopUpBaseAlgorithm::ReadSettings(xmlHandle);
 }
 
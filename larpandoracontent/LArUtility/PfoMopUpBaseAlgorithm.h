@@ -10,6 +10,9 @@
 
 #include "larpandoracontent/LArUtility/MopUpBaseAlgorithm.h"
 
+#include <unordered_map>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -38,9 +41,87 @@ public:
     static const pandora::Cluster *GetParentCluster(const pandora::ClusterList &clusterList, const pandora::HitType hitType);
 
 protected:
+    /**
+     *  @brief  Default constructor
+     */
+    PfoMopUpBaseAlgorithm();
+
+    virtual pandora::StatusCode Reset();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    /**
+     *  @brief  Get the pfos that are unchanged since the end of the previous run of this algorithm instance in the current event. For an
+     *          algorithm that runs until no further merges are found, no pair of unchanged pfos can pass its merge criteria, so such pairs
+     *          need not be considered, e.g. when the algorithm is run repeatedly by a recursive mop up algorithm.
+     *
+     *  @param  unchangedPfos to receive the unchanged pfos, empty if no state was recorded or if the current vertex list has changed
+     */
+    void GetUnchangedPfos(pandora::PfoSet &unchangedPfos) const;
+
+    /**
+     *  @brief  Record the state of the pfos in the daughter lists at the end of a run, for use by GetUnchangedPfos in the next run
+     *
+     *  @param  isConverged whether the run found all possible merges; if not, e.g. it stopped at an iteration limit, the recorded state
+     *          is discarded, so that the next run considers all pairs of pfos
+     */
+    void RecordEventState(const bool isConverged);
+
+private:
+    typedef std::vector<std::pair<const pandora::Cluster*, unsigned int>> ClusterStateList;
+
+    /**
+     *  @brief  PfoState class, the properties of a pfo used by the mop up algorithms to identify merges
+     */
+    class PfoState
+    {
+    public:
+        /**
+         *  @brief  Equality operator
+         *
+         *  @param  rhs the pfo state for comparison
+         *
+         *  @return whether the lhs and rhs are the same
+         */
+        bool operator==(const PfoState &rhs) const;
+
+        unsigned int            m_listIndex;                        ///< The index in m_daughterListNames of the list holding the pfo
+        int                     m_particleId;                       ///< The pfo particle id
+        float                   m_trackScore;                       ///< The pfo mva track score
+        ClusterStateList        m_clusterStates;                    ///< The address and number of hits of each of the pfo clusters
+    };
+
+    typedef std::unordered_map<const pandora::ParticleFlowObject*, PfoState> PfoStateMap;
+
+    /**
+     *  @brief  EventState class, the state of the pfos in the daughter lists and of the current vertex list
+     */
+    class EventState
+    {
+    public:
+        pandora::VertexVector   m_vertexVector;                     ///< The vertices in the current vertex list
+        PfoStateMap             m_pfoStateMap;                      ///< The state of each pfo in the daughter lists
+    };
+
+    /**
+     *  @brief  Get the state of the pfos in the daughter lists and of the current vertex list
+     *
+     *  @param  eventState to receive the event state
+     */
+    void GetEventState(EventState &eventState) const;
+
+    bool                        m_incrementalMopUp;                 ///< Whether to skip pairs of pfos unchanged since the previous run
+    bool                        m_hasEventState;                    ///< Whether the event state at the end of the previous run is recorded
+    EventState                  m_eventState;                       ///< The event state at the end of the previous run
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool PfoMopUpBaseAlgorithm::PfoState::operator==(const PfoState &rhs) const
+{
+    return ((m_listIndex == rhs.m_listIndex) && (m_particleId == rhs.m_particleId) && (m_trackScore == rhs.m_trackScore) &&
+        (m_clusterStates == rhs.m_clusterStates));
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_PFO_MOP_UP_BASE_ALGORITHM_H
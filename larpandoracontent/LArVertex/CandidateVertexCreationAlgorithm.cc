@@ -379,9 +379,9 @@ void CandidateVertexCreationAlgorithm::CreateCrossingVertices(const CartesianPoi
 void CandidateVertexCreationAlgorithm::AddToSlidingFitCache(const Cluster *const pCluster)
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-    const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitWindow, slidingFitPitch);
+    const TwoDSlidingFitResultPtr spSlidingFitResult(SlidingFitCache::GetSlidingFitResult(*this, pCluster, m_slidingFitWindow, slidingFitPitch));
 
-    if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult)).second)
+    if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultPtrMap::value_type(pCluster, spSlidingFitResult)).second)
         throw StatusCodeException(STATUS_CODE_FAILURE);
 }
 
@@ -389,12 +389,12 @@ void CandidateVertexCreationAlgorithm::AddToSlidingFitCache(const Cluster *const
 
 const TwoDSlidingFitResult &CandidateVertexCreationAlgorithm::GetCachedSlidingFitResult(const Cluster *const pCluster) const
 {
-    TwoDSlidingFitResultMap::const_iterator iter = m_slidingFitResultMap.find(pCluster);
+    TwoDSlidingFitResultPtrMap::const_iterator iter = m_slidingFitResultMap.find(pCluster);
 
     if (m_slidingFitResultMap.end() == iter)
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    return iter->second;
+    return *(iter->second);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -406,6 +406,15 @@ void CandidateVertexCreationAlgorithm::TidyUp()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CandidateVertexCreationAlgorithm::Reset()
+{
+    SlidingFitCache::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CandidateVertexCreationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle,
@@ -8,6 +8,7 @@
 #ifndef LAR_CANDIDATE_VERTEX_CREATION_ALGORITHM_H
 #define LAR_CANDIDATE_VERTEX_CREATION_ALGORITHM_H 1
 
+#include "larpandoracontent/LArObjects/LArSlidingFitCache.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 #include "Pandora/Algorithm.h"
@@ -105,7 +106,7 @@ private:
         const pandora::HitType hitType1, const pandora::HitType hitType2, unsigned int &nCrossingCandidates) const;
 
     /**
-     *  @brief  Creates a 2D sliding fit of a cluster and stores it for later use
+     *  @brief  Creates a 2D sliding fit of a cluster, or reuses an unchanged fit from the event cache, and stores it for later use
      *
      *  @param  pCluster address of the relevant cluster
      */
@@ -123,6 +124,7 @@ private:
      */
     void TidyUp();
 
+    pandora::StatusCode Reset();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     typedef std::unordered_map<const pandora::Cluster*, pandora::CartesianPointVector> ClusterToSpacepointsMap;
@@ -132,7 +134,7 @@ private:
     bool                    m_replaceCurrentVertexList;         ///< Whether to replace the current vertex list with the output list
 
     unsigned int            m_slidingFitWindow;                 ///< The layer window for the sliding linear fits
-    TwoDSlidingFitResultMap m_slidingFitResultMap;              ///< The sliding fit result map
+    TwoDSlidingFitResultPtrMap m_slidingFitResultMap;           ///< The sliding fit result map
 
     unsigned int            m_minClusterCaloHits;               ///< The min number of hits in base cluster selection method
     float                   m_minClusterLengthSquared;          ///< The min length (squared) in base cluster selection method
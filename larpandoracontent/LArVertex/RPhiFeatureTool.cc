@@ -13,6 +13,8 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -132,14 +134,23 @@ float RPhiFeatureTool::GetMidwayScore(const KernelEstimate &kernelEstimateU, con
     for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateW.GetContributionList())
         histogramW.Fill(contribution.first, contribution.second);
 
+    FloatVector binCenters;
+
+    for (int xBin = 0; xBin < histogramU.GetNBinsX(); ++xBin)
+        binCenters.push_back(histogramU.GetXLow() + (static_cast<float>(xBin) + 0.5f) * histogramU.GetXBinWidth());
+
+    FloatVector samplesU, samplesV, samplesW;
+    kernelEstimateU.Sample(binCenters, samplesU);
+    kernelEstimateV.Sample(binCenters, samplesV);
+    kernelEstimateW.Sample(binCenters, samplesW);
+
     float figureOfMerit(0.f);
 
     for (int xBin = 0; xBin < histogramU.GetNBinsX(); ++xBin)
     {
-        const float binCenter(histogramU.GetXLow() + (static_cast<float>(xBin) + 0.5f) * histogramU.GetXBinWidth());
-        figureOfMerit += histogramU.GetBinContent(xBin) * kernelEstimateU.Sample(binCenter);
-        figureOfMerit += histogramV.GetBinContent(xBin) * kernelEstimateV.Sample(binCenter);
-        figureOfMerit += histogramW.GetBinContent(xBin) * kernelEstimateW.Sample(binCenter);
+        figureOfMerit += histogramU.GetBinContent(xBin) * samplesU.at(xBin);
+        figureOfMerit += histogramV.GetBinContent(xBin) * samplesV.at(xBin);
+        figureOfMerit += histogramW.GetBinContent(xBin) * samplesW.at(xBin);
     }
 
     return figureOfMerit;
@@ -152,14 +163,21 @@ float RPhiFeatureTool::GetFullScore(const KernelEstimate &kernelEstimateU, const
 {
     float figureOfMerit(0.f);
 
-    for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateU.GetContributionList())
-        figureOfMerit += contribution.second * kernelEstimateU.Sample(contribution.first);
+    for (const KernelEstimate *const pKernelEstimate : {&kernelEstimateU, &kernelEstimateV, &kernelEstimateW})
+    {
+        const KernelEstimate::ContributionList &contributionList(pKernelEstimate->GetContributionList());
 
-    for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateV.GetContributionList())
-        figureOfMerit += contribution.second * kernelEstimateV.Sample(contribution.first);
+        FloatVector xValues, samples;
+        xValues.reserve(contributionList.size());
 
-    for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateW.GetContributionList())
-        figureOfMerit += contribution.second * kernelEstimateW.Sample(contribution.first);
+        for (const KernelEstimate::ContributionList::value_type &contribution : contributionList)
+            xValues.push_back(contribution.first);
+
+        pKernelEstimate->Sample(xValues, samples);
+
+        for (unsigned int iContribution = 0; iContribution < contributionList.size(); ++iContribution)
+            figureOfMerit += contributionList.at(iContribution).second * samples.at(iContribution);
+    }
 
     return figureOfMerit;
 }
@@ -218,8 +236,10 @@ float RPhiFeatureTool::atan2Fast(const float y, const float x) const
 float RPhiFeatureTool::KernelEstimate::Sample(const float x) const
 {
     const ContributionList &contributionList(this->GetContributionList());
-    ContributionList::const_iterator lowerIter(contributionList.lower_bound(x - 3.f * m_sigma));
-    ContributionList::const_iterator upperIter(contributionList.upper_bound(x + 3.f * m_sigma));
+    ContributionList::const_iterator lowerIter(std::lower_bound(contributionList.begin(), contributionList.end(), x - 3.f * m_sigma,
+        [](const ContributionList::value_type &contribution, const float value) { return contribution.first < value; }));
+    ContributionList::const_iterator upperIter(std::upper_bound(lowerIter, contributionList.end(), x + 3.f * m_sigma,
+        [](const float value, const ContributionList::value_type &contribution) { return value < contribution.first; }));
 
     float sample(0.f);
     const float gaussConstant(1.f / std::sqrt(2.f * M_PI * m_sigma * m_sigma));
@@ -236,9 +256,61 @@ float RPhiFeatureTool::KernelEstimate::Sample(const float x) const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void RPhiFeatureTool::KernelEstimate::Sample(const FloatVector &xValues, FloatVector &samples) const
+{
+    const ContributionList &contributionList(this->GetContributionList());
+    ContributionList::const_iterator lowerIter(contributionList.begin()), upperIter(contributionList.begin());
+
+    const float gaussConstant(1.f / std::sqrt(2.f * M_PI * m_sigma * m_sigma));
+    samples.clear();
+    samples.reserve(xValues.size());
+
+    for (const float x : xValues)
+    {
+        // ATTN Both window edges are non-decreasing for ascending x, so each contribution enters and leaves the window once
+        const float lowerEdge(x - 3.f * m_sigma), upperEdge(x + 3.f * m_sigma);
+
+        while ((contributionList.end() != lowerIter) && (lowerIter->first < lowerEdge))
+            ++lowerIter;
+
+        if (upperIter < lowerIter)
+            upperIter = lowerIter;
+
+        while ((contributionList.end() != upperIter) && !(upperEdge < upperIter->first))
+            ++upperIter;
+
+        float sample(0.f);
+
+        for (ContributionList::const_iterator iter = lowerIter; iter != upperIter; ++iter)
+        {
+            const float deltaSigma((x - iter->first) / m_sigma);
+            const float gaussian(gaussConstant * std::exp(-0.5f * deltaSigma * deltaSigma));
+            sample += iter->second * gaussian;
+        }
+
+        samples.push_back(sample);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void RPhiFeatureTool::KernelEstimate::AddContribution(const float x, const float weight)
 {
-    m_contributionList.insert(ContributionList::value_type(x, weight));
+    m_contributionList.emplace_back(x, weight);
+    m_isSorted = false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RPhiFeatureTool::KernelEstimate::SortContributions() const
+{
+    if (m_isSorted)
+        return;
+
+    // ATTN Stable sort retains insertion order for equal x, matching the previous multimap ordering, so that summation order is unchanged
+    std::stable_sort(m_contributionList.begin(), m_contributionList.end(),
+        [](const ContributionList::value_type &lhs, const ContributionList::value_type &rhs) { return lhs.first < rhs.first; });
+    m_isSorted = true;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -44,7 +44,7 @@ public:
 
 private:
     /**
-     *  @brief Kernel estimate class
+     *  @brief Kernel estimate class, holding contributions in a flat array sorted by x coordinate (and, for equal x, insertion order)
      */
     class KernelEstimate
     {
@@ -65,7 +65,16 @@ private:
          */
         float Sample(const float x) const;
 
-        typedef std::multimap<float, float> ContributionList;   ///< Map from x coord to weight, ATTN avoid map.find, etc. with float key
+        /**
+         *  @brief  Sample the parameterised distribution at each of a list of x coordinates, which must be in ascending order.
+         *          The results are identical to those from Sample, but the contributions are found using a single sliding window.
+         *
+         *  @param  xValues the ascending positions at which to sample
+         *  @param  samples to receive the sample values, in the order of the positions
+         */
+        void Sample(const pandora::FloatVector &xValues, pandora::FloatVector &samples) const;
+
+        typedef std::vector<std::pair<float, float>> ContributionList;   ///< List of x coord and weight, sorted by x coord
 
         /**
          *  @brief  Get the contribution list
@@ -90,7 +99,13 @@ private:
         void AddContribution(const float x, const float weight);
 
     private:
-        ContributionList            m_contributionList;         ///< The contribution list
+        /**
+         *  @brief  Sort the contribution list by x coordinate, if contributions have been added since it was last sorted
+         */
+        void SortContributions() const;
+
+        mutable ContributionList    m_contributionList;         ///< The contribution list
+        mutable bool                m_isSorted;                 ///< Whether the contribution list is currently sorted
         const float                 m_sigma;                    ///< The assigned width
     };
 
@@ -180,6 +195,7 @@ private:
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma) :
+    m_isSorted(true),
     m_sigma(sigma)
 {
     if (m_sigma < std::numeric_limits<float>::epsilon())
@@ -190,6 +206,7 @@ inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma) :
 
 inline const RPhiFeatureTool::KernelEstimate::ContributionList &RPhiFeatureTool::KernelEstimate::GetContributionList() const
 {
+    this->SortContributions();
     return m_contributionList;
 }
 
@@ -37,6 +37,7 @@ TrainedVertexSelectionAlgorithm::TrainedVertexSelectionAlgorithm() :
     m_trainingSetMode(false),
     m_allowClassifyDuringTraining(false),
     m_mcVertexXCorrection(0.f),
+    m_trainingOutputFormat(LArMvaHelper::TEXT_OUTPUT),
     m_minClusterCaloHits(12),
     m_slidingFitWindow(100),
     m_minShowerSpineLength(15.f),
@@ -471,6 +472,8 @@ void TrainedVertexSelectionAlgorithm::ProduceTrainingSets(const VertexVector &ve
         this->ProduceTrainingExamples(regionalVertices, vertexFeatureInfoMap, coinFlip, generator, interactionType, m_trainingOutputFileVertex,
             eventFeatureList, m_maxTrueVertexRadius, true);
     }
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMvaHelper::FlushTrainingExamples());
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -557,14 +560,14 @@ const pandora::Vertex * TrainedVertexSelectionAlgorithm::ProduceTrainingExamples
         {
             if (coinFlip(generator))
             {
-                LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", true, eventFeatureList,
-                    bestVertexFeatureList, featureList);
+                LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", m_trainingOutputFormat, true,
+                    eventFeatureList, bestVertexFeatureList, featureList);
             }
 
             else
             {
-                LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", false, eventFeatureList, featureList,
-                    bestVertexFeatureList);
+                LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", m_trainingOutputFormat, false,
+                    eventFeatureList, featureList, bestVertexFeatureList);
             }
         }
     }
@@ -676,6 +679,11 @@ StatusCode TrainedVertexSelectionAlgorithm::ReadSettings(const TiXmlHandle xmlHa
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "TrainingOutputFileVertex", m_trainingOutputFileVertex));
 
+    bool writeBinaryTrainingExamples(false);
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "WriteBinaryTrainingExamples", writeBinaryTrainingExamples));
+    m_trainingOutputFormat = (writeBinaryTrainingExamples ? LArMvaHelper::TEXT_AND_BINARY_OUTPUT : LArMvaHelper::TEXT_OUTPUT);
+
     if (m_trainingSetMode && (m_trainingOutputFileRegion.empty() || m_trainingOutputFileVertex.empty()))
     {
         std::cout << "TrainedVertexSelectionAlgorithm: TrainingOutputFileRegion and TrainingOutputFileVertex are required for training set " <<
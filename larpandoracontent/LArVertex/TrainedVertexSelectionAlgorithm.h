@@ -368,6 +368,7 @@ protected:
     float                 m_mcVertexXCorrection;                  ///< The correction to the x-coordinate of the MC vertex position
     std::string           m_trainingOutputFileRegion;             ///< The training output file for the region mva
     std::string           m_trainingOutputFileVertex;             ///< The training output file for the vertex mva
+    LArMvaHelper::TrainingOutputFormat m_trainingOutputFormat;    ///< The output format for training examples
     std::string           m_mcParticleListName;                   ///< The MC particle list for creating training examples
     std::string           m_caloHitListName;                      ///< The 2D CaloHit list name
 
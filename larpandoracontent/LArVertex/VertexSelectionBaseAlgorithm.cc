@@ -131,7 +131,7 @@ void VertexSelectionBaseAlgorithm::CalculateClusterSlidingFits(const ClusterList
 
         // Make sure the window size is such that there are not more layers than hits (following TwoDSlidingLinearFit calculation).
         const unsigned int newSlidingFitWindow(std::min(static_cast<int>(pCluster->GetNCaloHits()), static_cast<int>(slidingFitPitch * slidingFitWindow)));
-        slidingFitDataList.emplace_back(pCluster, newSlidingFitWindow, slidingFitPitch);
+        slidingFitDataList.emplace_back(*SlidingFitCache::GetSlidingFitResult(*this, pCluster, newSlidingFitWindow, slidingFitPitch));
     }
 }
 
@@ -300,19 +300,13 @@ bool VertexSelectionBaseAlgorithm::SortByVertexZPosition(const pandora::Vertex *
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-VertexSelectionBaseAlgorithm::SlidingFitData::SlidingFitData(const pandora::Cluster *const pCluster, const int slidingFitWindow,
-        const float slidingFitPitch) :
-    m_minLayerDirection(0.f, 0.f, 0.f),
-    m_maxLayerDirection(0.f, 0.f, 0.f),
-    m_minLayerPosition(0.f, 0.f, 0.f),
-    m_maxLayerPosition(0.f, 0.f, 0.f),
-    m_pCluster(pCluster)
+VertexSelectionBaseAlgorithm::SlidingFitData::SlidingFitData(const TwoDSlidingFitResult &slidingFitResult) :
+    m_minLayerDirection(slidingFitResult.GetGlobalMinLayerDirection()),
+    m_maxLayerDirection(slidingFitResult.GetGlobalMaxLayerDirection()),
+    m_minLayerPosition(slidingFitResult.GetGlobalMinLayerPosition()),
+    m_maxLayerPosition(slidingFitResult.GetGlobalMaxLayerPosition()),
+    m_pCluster(slidingFitResult.GetCluster())
 {
-    const TwoDSlidingFitResult slidingFitResult(pCluster, slidingFitWindow, slidingFitPitch);
-    m_minLayerDirection = slidingFitResult.GetGlobalMinLayerDirection();
-    m_maxLayerDirection = slidingFitResult.GetGlobalMaxLayerDirection();
-    m_minLayerPosition = slidingFitResult.GetGlobalMinLayerPosition();
-    m_maxLayerPosition = slidingFitResult.GetGlobalMaxLayerPosition();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -346,6 +340,15 @@ pandora::CartesianPointVector VertexSelectionBaseAlgorithm::ShowerCluster::GetCl
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode VertexSelectionBaseAlgorithm::Reset()
+{
+    SlidingFitCache::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode VertexSelectionBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle,
@@ -14,6 +14,7 @@
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
 
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
+#include "larpandoracontent/LArObjects/LArSlidingFitCache.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 namespace lar_content
@@ -121,11 +122,9 @@ public:
         /**
          *  @brief  Constructor
          *
-         *  @param  pCluster pointer to the cluster
-         *  @param  slidingFitWindow the sliding fit window
-         *  @param  slidingFitPitch the sliding fit pitch
+         *  @param  slidingFitResult the sliding fit result for the cluster
          */
-        SlidingFitData(const pandora::Cluster *const pCluster, const int slidingFitWindow, const float slidingFitPitch);
+        SlidingFitData(const TwoDSlidingFitResult &slidingFitResult);
 
         /**
          *  @brief  Get the min layer direction
@@ -303,6 +302,7 @@ protected:
      */
     bool IsBeamModeOn() const;
 
+    pandora::StatusCode Reset();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
 private: